@@ -228,6 +228,23 @@ static constexpr char inference_only_message[] =
     " To enable full mode for static models pass \"false\" value to this argument:"
     " ex. \"-inference_only=false\".\n";
 
+static constexpr char rate_message[] =
+    "Optional. Target rate of the inference requests per second. Enables the open-loop mode: the requests arrive\n"
+    "                                  by the -arrival process regardless of the completion of the previous ones and\n"
+    "                                  wait in a queue for an idle infer request. The latency is reported separately for\n"
+    "                                  the queueing and the inference. Default value is 0 (closed loop).";
+
+static constexpr char arrival_message[] =
+    "Optional. Arrival process of the open-loop mode:\n"
+    "                                  'poisson' (default) - exponentially distributed intervals with the -rate mean,\n"
+    "                                  'uniform' - equal intervals of 1/rate,\n"
+    "                                  'trace' - replay of the arrival times from the -arrival_trace file.\n"
+    "                                  'poisson' and 'uniform' require the -rate option.";
+
+static constexpr char arrival_trace_message[] =
+    "Optional. Path to a text file with the arrival times in milliseconds from the start of the measurement,\n"
+    "                                  one per line. Used with -arrival trace.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -361,6 +378,15 @@ DEFINE_string(imean, "", input_image_mean_message);
 /// @brief Define flag for inference only mode <br>
 DEFINE_bool(inference_only, true, inference_only_message);
 
+/// @brief Define flag for the target request rate of the open-loop mode <br>
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief Define flag for the arrival process of the open-loop mode <br>
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Define flag for the arrival trace of the open-loop mode <br>
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
 /**
  * @brief This function show a help message
  */
@@ -390,6 +416,10 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << std::endl << "  Open-loop load generation options:" << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -arrival \"<process>\"      " << arrival_message << std::endl;
+    std::cout << "    -arrival_trace \"<path>\"   " << arrival_trace_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
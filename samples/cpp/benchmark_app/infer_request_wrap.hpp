@@ -23,7 +23,8 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, size_t group_id, const double latency, const double queue_latency)>
+    QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
 /// time.
@@ -42,12 +43,20 @@ public:
         _request.set_callback([&](const std::exception_ptr& ptr) {
             // TODO: Add exception ptr rethrow in proper thread
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), get_queue_time_in_milliseconds());
         });
     }
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request that arrived at the given time and was waiting for an idle request since then
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.start_async();
     }
 
@@ -57,9 +66,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), get_queue_time_in_milliseconds());
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -84,6 +94,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queue_time_in_milliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -97,6 +112,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -116,7 +132,8 @@ public:
                                                                         this,
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
-                                                                        std::placeholders::_3)));
+                                                                        std::placeholders::_3,
+                                                                        std::placeholders::_4)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,6 +154,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queue_latencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -146,9 +164,10 @@ public:
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
+    void put_idle_request(size_t id, size_t lat_group_id, const double latency, const double queue_latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queue_latencies.push_back(queue_latency);
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -168,6 +187,20 @@ public:
         return request;
     }
 
+    /// @brief Waits for an idle request until the deadline, returns nullptr if there is none by then
+    InferReqWrap::Ptr get_idle_request(const Time::time_point& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_cv.wait_until(lock, deadline, [this] {
+                return _idleIds.size() > 0;
+            })) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void wait_all() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this] {
@@ -179,6 +212,22 @@ public:
         return _latencies;
     }
 
+    /// @brief Time from the arrival till the start of the inference, zero for the closed loop
+    std::vector<double> get_queue_latencies() {
+        return _queue_latencies;
+    }
+
+    /// @brief Queueing and inference time of every request
+    std::vector<double> get_total_latencies() {
+        std::vector<double> total(_latencies.size());
+        std::transform(_latencies.begin(),
+                       _latencies.end(),
+                       _queue_latencies.begin(),
+                       total.begin(),
+                       std::plus<double>());
+        return total;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -192,6 +241,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queue_latencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
 };
@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +57,24 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("The request rate value is incorrect. Please set a positive -rate value.");
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "uniform" && FLAGS_arrival != "trace") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `poisson`, `uniform` or "
+                               "`trace` value.");
+    }
+    if (FLAGS_arrival != "trace" && FLAGS_rate <= 0 && !gflags::GetCommandLineFlagInfoOrDie("arrival").is_default) {
+        throw std::logic_error("The " + FLAGS_arrival +
+                               " arrival process requires the request rate. Please set a positive -rate value.");
+    }
+    if (FLAGS_arrival == "trace" && FLAGS_arrival_trace.empty()) {
+        throw std::logic_error("Arrival trace file is required for the trace arrival process. Please set "
+                               "-arrival_trace option.");
+    }
+    if ((FLAGS_rate > 0 || FLAGS_arrival == "trace") && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode is supported for the async API only.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -713,10 +733,13 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // Requests arrive by the schedule independent of the completion of the previous ones in the open-loop mode
+        const bool openLoop = FLAGS_rate > 0 || FLAGS_arrival == "trace";
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             if (shape_groups_num > nireq) {
                 niter = ((niter + shape_groups_num - 1) / shape_groups_num) * shape_groups_num;
                 if (FLAGS_niter != niter) {
@@ -744,6 +767,11 @@ int main(int argc, char* argv[]) {
         }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
 
+        std::vector<double> arrivals;
+        if (openLoop) {
+            arrivals = get_arrival_times(FLAGS_arrival, FLAGS_rate, FLAGS_arrival_trace, niter, duration_seconds);
+        }
+
         if (statistics) {
             statistics->add_parameters(
                 StatisticsReport::Category::RUNTIME_CONFIG,
@@ -769,6 +797,13 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
                                            {StatisticsVariant(ss.str(), dev_name + "_streams_num", nstreams.second)});
             }
+            if (openLoop) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("arrival process", "arrival_process", FLAGS_arrival),
+                     StatisticsVariant("target request rate", "target_rate", FLAGS_rate),
+                     StatisticsVariant("number of arrivals", "arrivals_num", arrivals.size())});
+            }
         }
 
         // ----------------- 9. Creating infer requests and filling input blobs
@@ -856,6 +891,13 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (openLoop) {
+            progressBarTotalCount = arrivals.size();
+            ss << ", open loop: " << arrivals.size() << " requests arriving by " << FLAGS_arrival << " process";
+            if (FLAGS_arrival != "trace") {
+                ss << " at " << double_to_string(FLAGS_rate) << " requests/s";
+            }
+        }
 
         next_step(ss.str());
 
@@ -943,27 +985,13 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
-            }
-
+        // the inputs of the request are set in the loop for the full mode
+        auto set_inputs = [&](const InferReqWrap::Ptr& request) {
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
                 if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                    request->set_latency_group_id(iteration % app_inputs_info.size());
                 }
 
                 if (isDynamicNetwork) {
@@ -983,46 +1011,101 @@ int main(int argc, char* argv[]) {
                 for (auto& item : inputs) {
                     auto inputName = item.first;
                     const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                    request->set_tensor(inputName, data);
                 }
 
                 if (useGpuMem) {
                     auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                        ::gpu::get_remote_output_tensors(compiledModel, request->get_output_cl_buffer());
                     for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                        request->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                     }
                 }
             }
+        };
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
+        size_t processedFramesN = 0;
+        auto startTime = Time::now();
+        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+        /** Start inference & calculate performance **/
+        /** to align number if iterations to guarantee that last infer requests are
+         * executed in the same conditions **/
+        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+        if (openLoop) {
+            // the arrived requests waiting for an idle infer request
+            std::deque<Time::time_point> pending;
+            size_t arrived = 0;
+            auto arrival_time = [&](size_t idx) {
+                return startTime + std::chrono::duration_cast<Time::duration>(
+                                       std::chrono::duration<double, std::milli>(arrivals[idx]));
+            };
+            while (arrived < arrivals.size() || !pending.empty()) {
+                const auto now = Time::now();
+                for (; arrived < arrivals.size() && arrival_time(arrived) <= now; ++arrived) {
+                    pending.push_back(arrival_time(arrived));
+                }
+                if (pending.empty()) {
+                    std::this_thread::sleep_until(arrival_time(arrived));
+                    continue;
+                }
+
+                // stop waiting at the next arrival to keep its timestamp precise
+                inferRequest = arrived < arrivals.size() ? inferRequestsQueue.get_idle_request(arrival_time(arrived))
+                                                         : inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    continue;
+                }
+
+                set_inputs(inferRequest);
                 inferRequest->wait();
-                inferRequest->start_async();
+                inferRequest->start_async(pending.front());
+                pending.pop_front();
+                ++iteration;
+
+                processedFramesN += batchSize;
+                progressBar.add_progress(1);
             }
-            ++iteration;
+        } else {
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+                set_inputs(inferRequest);
 
-            if (niter > 0) {
-                progressBar.add_progress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.add_progress(newProgress);
-                progressCnt += newProgress;
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    inferRequest->start_async();
+                }
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+
+                if (niter > 0) {
+                    progressBar.add_progress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.add_progress(newProgress);
+                    progressCnt += newProgress;
+                }
             }
         }
 
@@ -1047,6 +1130,14 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // queueing and inference parts of the latency are reported separately for the open loop
+        LatencyDistribution queueLatency, inferenceLatency, totalLatency;
+        if (openLoop) {
+            queueLatency = LatencyDistribution(inferRequestsQueue.get_queue_latencies());
+            inferenceLatency = LatencyDistribution(inferRequestsQueue.get_latencies());
+            totalLatency = LatencyDistribution(inferRequestsQueue.get_total_latencies());
+        }
+
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.median_or_percentile
                                            : 1000.0 * processedFramesN / totalDuration;
@@ -1080,6 +1171,14 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            if (openLoop) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("achieved request rate", "achieved_rate", 1000.0 * iteration / totalDuration),
+                     StatisticsVariant("queue latency (ms)", "queue_latency", queueLatency),
+                     StatisticsVariant("inference latency (ms)", "inference_latency", inferenceLatency),
+                     StatisticsVariant("total latency (ms)", "total_latency", totalLatency)});
+            }
         }
         progressBar.finish();
 
@@ -1145,6 +1244,20 @@ int main(int argc, char* argv[]) {
                 }
             }
         }
+        if (openLoop) {
+            slog::info << "Request rate: " << double_to_string(1000.0 * iteration / totalDuration)
+                       << " requests/s achieved";
+            if (FLAGS_arrival != "trace") {
+                slog::info << ", " << double_to_string(FLAGS_rate) << " requests/s target";
+            }
+            slog::info << slog::endl;
+            slog::info << "Queue latency:" << slog::endl;
+            queueLatency.write_to_slog();
+            slog::info << "Inference latency:" << slog::endl;
+            inferenceLatency.write_to_slog();
+            slog::info << "Total latency:" << slog::endl;
+            totalLatency.write_to_slog();
+        }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
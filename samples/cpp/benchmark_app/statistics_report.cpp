@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -283,6 +284,73 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     max = latencies.back();
 };
 
+LatencyDistribution::LatencyDistribution(const std::vector<double>& latencies) {
+    if (latencies.empty()) {
+        throw std::logic_error("Latency distribution class expects non-empty vector of latencies at construction.");
+    }
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    // nearest-rank percentile
+    auto percentile = [&sorted](double p) {
+        const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+    };
+    p50 = percentile(50);
+    p90 = percentile(90);
+    p99 = percentile(99);
+    p99_9 = percentile(99.9);
+    min = sorted.front();
+    max = sorted.back();
+    avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+
+    // 4 buckets per power of two starting from 1 us keep the relative error of the bucket under 19%
+    constexpr double first_bound = 0.001;
+    const double step = std::pow(2.0, 0.25);
+    double bound = first_bound;
+    auto it = sorted.begin();
+    while (it != sorted.end()) {
+        auto next = std::upper_bound(it, sorted.end(), bound);
+        if (next != it || !histogram.empty()) {
+            histogram.emplace_back(bound, static_cast<size_t>(std::distance(it, next)));
+        }
+        it = next;
+        bound *= step;
+    }
+}
+
+void LatencyDistribution::write_to_stream(std::ostream& stream) const {
+    std::ios::fmtflags fmt(stream.flags());
+    stream << std::fixed << std::setprecision(2) << p50 << ";" << p90 << ";" << p99 << ";" << p99_9 << ";" << avg
+           << ";" << min << ";" << max;
+    stream.flags(fmt);
+}
+
+void LatencyDistribution::write_to_slog() const {
+    slog::info << "\tMedian:     " << double_to_string(p50) << " ms" << slog::endl;
+    slog::info << "\t90 %:       " << double_to_string(p90) << " ms" << slog::endl;
+    slog::info << "\t99 %:       " << double_to_string(p99) << " ms" << slog::endl;
+    slog::info << "\t99.9 %:     " << double_to_string(p99_9) << " ms" << slog::endl;
+    slog::info << "\tAverage:    " << double_to_string(avg) << " ms" << slog::endl;
+    slog::info << "\tMin:        " << double_to_string(min) << " ms" << slog::endl;
+    slog::info << "\tMax:        " << double_to_string(max) << " ms" << slog::endl;
+}
+
+const nlohmann::json LatencyDistribution::to_json() const {
+    nlohmann::json stat;
+    stat["p50"] = p50;
+    stat["p90"] = p90;
+    stat["p99"] = p99;
+    stat["p99_9"] = p99_9;
+    stat["average"] = avg;
+    stat["min"] = min;
+    stat["max"] = max;
+    stat["histogram"] = nlohmann::json::array();
+    for (const auto& bucket : histogram) {
+        stat["histogram"].push_back({{"upper_bound", bucket.first}, {"count", bucket.second}});
+    }
+    return stat;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
@@ -293,11 +361,17 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case DISTRIBUTION: {
+        std::ostringstream str;
+        distribution_val.write_to_stream(str);
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -322,6 +396,9 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(metrics_val.to_json());
     } break;
+    case DISTRIBUTION:
+        js[json_name] = distribution_val.to_json();
+        break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
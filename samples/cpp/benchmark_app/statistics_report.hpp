@@ -52,9 +52,32 @@ private:
     size_t percentile_boundary = 50;
 };
 
+/// @brief Percentiles and log-scale histogram of the latencies, used to locate the capacity limit in the open-loop mode
+class LatencyDistribution {
+public:
+    LatencyDistribution() {}
+
+    explicit LatencyDistribution(const std::vector<double>& latencies);
+
+    void write_to_stream(std::ostream& stream) const;
+    void write_to_slog() const;
+    const nlohmann::json to_json() const;
+
+public:
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p99_9 = 0;
+    double avg = 0;
+    double min = 0;
+    double max = 0;
+    // pairs of the bucket upper bound in ms and the number of latencies in (previous bound, bound]
+    std::vector<std::pair<double, size_t>> histogram;
+};
+
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, DISTRIBUTION };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -91,6 +114,11 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const LatencyDistribution& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          distribution_val(v),
+          type(DISTRIBUTION) {}
 
     ~StatisticsVariant() {}
 
@@ -101,6 +129,7 @@ public:
     unsigned long long ull_val = 0;
     std::string s_val;
     LatencyMetrics metrics_val;
+    LatencyDistribution distribution_val;
     Type type;
 
     std::string to_string() const;
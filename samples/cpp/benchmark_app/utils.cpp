@@ -5,8 +5,10 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <fstream>
 #include <map>
 #include <nlohmann/json.hpp>
+#include <random>
 #include <regex>
 #include <string>
 #include <utility>
@@ -664,6 +666,61 @@ std::vector<benchmark_app::InputsInfo> get_inputs_info(const std::string& shape_
                            reshape_required);
 }
 
+std::vector<double> get_arrival_times(const std::string& arrival_process,
+                                      double rate,
+                                      const std::string& trace_path,
+                                      uint32_t niter,
+                                      uint32_t duration_seconds) {
+    const double duration_ms = static_cast<double>(get_duration_in_milliseconds(duration_seconds));
+    auto limit_reached = [&](size_t count, double arrival_ms) {
+        return (niter != 0 && count >= niter) || (duration_seconds != 0 && arrival_ms >= duration_ms);
+    };
+    if (niter == 0 && duration_seconds == 0) {
+        throw std::logic_error("Open-loop mode requires the number of iterations or the duration limit");
+    }
+
+    std::vector<double> arrivals;
+    if (arrival_process == "trace") {
+        std::ifstream trace(trace_path);
+        if (!trace.is_open()) {
+            throw std::runtime_error("Can't open arrival trace file \"" + trace_path + "\".");
+        }
+        std::vector<double> times;
+        double arrival_ms;
+        while (trace >> arrival_ms) {
+            times.push_back(arrival_ms);
+        }
+        if (!trace.eof()) {
+            throw std::runtime_error("Can't parse arrival trace file \"" + trace_path + "\".");
+        }
+        std::sort(times.begin(), times.end());
+        for (auto time : times) {
+            if (limit_reached(arrivals.size(), time))
+                break;
+            arrivals.push_back(time);
+        }
+    } else if (arrival_process == "poisson") {
+        // fixed seed keeps the runs with the same options comparable
+        std::mt19937 generator(0);
+        std::exponential_distribution<double> interval_ms(rate / 1000.0);
+        for (double arrival_ms = 0; !limit_reached(arrivals.size(), arrival_ms); arrival_ms += interval_ms(generator)) {
+            arrivals.push_back(arrival_ms);
+        }
+    } else if (arrival_process == "uniform") {
+        for (double arrival_ms = 0; !limit_reached(arrivals.size(), arrival_ms);
+             arrival_ms = arrivals.size() * 1000.0 / rate) {
+            arrivals.push_back(arrival_ms);
+        }
+    } else {
+        throw std::logic_error("Unknown arrival process \"" + arrival_process + "\"");
+    }
+
+    if (arrivals.empty()) {
+        throw std::logic_error("No requests arrive within the benchmark limits");
+    }
+    return arrivals;
+}
+
 #ifdef USE_OPENCV
 void dump_config(const std::string& filename, const std::map<std::string, ov::AnyMap>& config) {
     slog::warn << "YAML and XML formats for config file won't be supported soon." << slog::endl;
@@ -122,6 +122,21 @@ std::vector<benchmark_app::InputsInfo> get_inputs_info(const std::string& shape_
                                                        const std::string& mean_string,
                                                        const std::vector<ov::Output<const ov::Node>>& input_info);
 
+/// <summary>
+/// Generates the arrival times of the inference requests for the open-loop mode
+/// </summary>
+/// <param name="arrival_process">poisson, uniform or trace</param>
+/// <param name="rate">target number of the requests per second, ignored for the trace</param>
+/// <param name="trace_path">file with the arrival times in milliseconds, one per line</param>
+/// <param name="niter">maximal number of the requests, 0 for no limit</param>
+/// <param name="duration_seconds">maximal arrival time, 0 for no limit</param>
+/// <returns>sorted arrival times in milliseconds from the start of the measurement</returns>
+std::vector<double> get_arrival_times(const std::string& arrival_process,
+                                      double rate,
+                                      const std::string& trace_path,
+                                      uint32_t niter,
+                                      uint32_t duration_seconds);
+
 void dump_config(const std::string& filename, const std::map<std::string, ov::AnyMap>& config);
 void load_config(const std::string& filename, std::map<std::string, ov::AnyMap>& config);
 
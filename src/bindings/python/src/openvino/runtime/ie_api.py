@@ -21,8 +21,12 @@ def tensor_from_file(path: str) -> Tensor:
     return Tensor(np.fromfile(path, dtype=np.uint8))
 
 
-def convert_dict_items(inputs: dict, py_types: dict) -> dict:
-    """Helper function converting dictionary items to Tensors."""
+def convert_dict_items(inputs: dict, py_types: dict, shared_memory: bool = False) -> dict:
+    """Helper function converting dictionary items to Tensors.
+
+    If shared_memory is True, Tensors share the memory of numpy arrays which are C contiguous
+    and have the expected data type, the other values are copied.
+    """
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
     # ensuring that original inputs are not overwritten with Tensors.
@@ -35,22 +39,30 @@ def convert_dict_items(inputs: dict, py_types: dict) -> dict:
         except KeyError:
             raise KeyError("Port for tensor {} was not found!".format(k))
         # Convert numpy arrays or copy Tensors
-        new_inputs[k] = (
-            val
-            if isinstance(val, Tensor)
-            else Tensor(np.array(val, get_dtype(ov_type), copy=False))
-        )
+        if isinstance(val, Tensor):
+            new_inputs[k] = val
+        elif shared_memory:
+            # No-op for the arrays which already are C contiguous and of the expected type
+            new_inputs[k] = Tensor(
+                np.require(val, get_dtype(ov_type), requirements="C"), shared_memory=True
+            )
+        else:
+            new_inputs[k] = Tensor(np.array(val, get_dtype(ov_type), copy=False))
     return new_inputs
 
 
-def normalize_inputs(inputs: Union[dict, list], py_types: dict) -> dict:
+def normalize_inputs(
+    inputs: Union[dict, list], py_types: dict, shared_memory: bool = False
+) -> dict:
     """Normalize a dictionary of inputs to Tensors."""
     if isinstance(inputs, dict):
-        return convert_dict_items(inputs, py_types)
+        return convert_dict_items(inputs, py_types, shared_memory)
     elif isinstance(inputs, list):
         # Lists are required to be represented as dictionaries with int keys
         return convert_dict_items(
-            {index: input for index, input in enumerate(inputs)}, py_types
+            {index: input for index, input in enumerate(inputs)},
+            py_types,
+            shared_memory,
         )
     else:
         raise TypeError(
@@ -84,7 +96,12 @@ def get_input_types(obj: Union[InferRequestBase, CompiledModelBase]) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Union[dict, list] = None) -> dict:
+    def infer(
+        self,
+        inputs: Union[dict, list] = None,
+        shared_memory: bool = True,
+        share_outputs: bool = False,
+    ) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -103,11 +120,29 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Union[Dict[keys, values], List[values]], optional
+        :param shared_memory: If `True`, input tensors share the memory of C contiguous
+                              numpy arrays of the expected data type instead of copying
+                              them. The arrays are kept alive while the InferRequest uses
+                              them. Other values are always copied. Default: True
+
+                              The request and the caller use the same memory: the changes of
+                              the array are seen by the next inference of the request, even
+                              without passing the inputs again, and the writes to the data of
+                              `get_input_tensor()` change the array. Pass `False` to keep the
+                              arrays and the request independent.
+        :type shared_memory: bool, optional
+        :param share_outputs: If `True`, results are numpy views of the output tensors
+                              without copying. The content of the views is overwritten
+                              by the next inference of this InferRequest. Default: False
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         return super().infer(
-            {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
+            {}
+            if inputs is None
+            else normalize_inputs(inputs, get_input_types(self), shared_memory),
+            share_outputs,
         )
 
     def start_async(
@@ -7,6 +7,7 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <mutex>
@@ -97,41 +98,71 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, size_t batch_size) {
+        if (batch_size == 0) {
+            throw ov::Exception("AsyncInferQueue callback batch size must be greater than 0!");
+        }
+        // the requests of the batch are not returned to the pool until the delivery, so the batch larger than the pool
+        // is never collected, it is split into the batches of the pool size
+        batch_size = std::min(batch_size, _requests.size());
         for (size_t handle = 0; handle < _requests.size(); handle++) {
-            _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
-                _requests[handle]._end_time = Time::now();
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
+            _requests[handle]._request.set_callback(
+                [this, f_callback, batch_size, handle](std::exception_ptr exception_ptr) {
+                    _requests[handle]._end_time = Time::now();
+                    try {
+                        if (exception_ptr) {
+                            std::rethrow_exception(exception_ptr);
+                        }
+                    } catch (const std::exception& e) {
+                        throw ov::Exception(e.what());
                     }
-                } catch (const std::exception& e) {
-                    throw ov::Exception(e.what());
-                }
-                // Acquire GIL, execute Python function
-                py::gil_scoped_acquire acquire;
-                try {
-                    f_callback(_requests[handle], _user_ids[handle]);
-                } catch (py::error_already_set py_error) {
-                    assert(PyErr_Occurred());
-                    // acquire the mutex to access _errors
-                    std::lock_guard<std::mutex> lock(_mutex);
-                    _errors.push(py_error);
-                }
-                {
-                    // acquire the mutex to access _idle_handles
-                    std::lock_guard<std::mutex> lock(_mutex);
-                    // Add idle handle to queue
-                    _idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                _cv.notify_one();
-            });
+                    std::vector<size_t> completed;
+                    {
+                        // acquire the mutex to access _completed_handles and _idle_handles
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _completed_handles.push_back(handle);
+                        // Deliver the batch once it is full or when no other request is running,
+                        // so the completed requests never wait for the results which are not going to come
+                        if (_completed_handles.size() >= batch_size ||
+                            _completed_handles.size() + _idle_handles.size() == _requests.size()) {
+                            std::swap(completed, _completed_handles);
+                        }
+                    }
+                    if (completed.empty()) {
+                        return;
+                    }
+                    {
+                        // Acquire GIL once for the whole batch, execute Python function
+                        py::gil_scoped_acquire acquire;
+                        for (auto&& completed_handle : completed) {
+                            try {
+                                f_callback(_requests[completed_handle], _user_ids[completed_handle]);
+                            } catch (py::error_already_set py_error) {
+                                assert(PyErr_Occurred());
+                                // acquire the mutex to access _errors
+                                std::lock_guard<std::mutex> lock(_mutex);
+                                _errors.push(py_error);
+                            }
+                        }
+                    }
+                    {
+                        // acquire the mutex to access _idle_handles
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        // Add idle handles to queue
+                        for (auto&& completed_handle : completed) {
+                            _idle_handles.push(completed_handle);
+                        }
+                    }
+                    // Notify locks in getIdleRequestId()
+                    _cv.notify_all();
+                });
         }
     }
 
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
+    // completed requests waiting for the batched delivery to the Python callback
+    std::vector<size_t> _completed_handles;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
@@ -257,9 +288,11 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def(
         "set_callback",
-        [](AsyncInferQueue& self, py::function callback) {
-            self.set_custom_callbacks(callback);
+        [](AsyncInferQueue& self, py::function callback, size_t batch_size) {
+            self.set_custom_callbacks(callback, batch_size);
         },
+        py::arg("callback"),
+        py::arg("batch_size") = 1,
         R"(
         Sets unified callback on all InferRequests from queue's pool.
         The signature of such function should have two arguments, where
@@ -274,8 +307,22 @@ void regclass_AsyncInferQueue(py::module m) {
 
             async_infer_queue.set_callback(f)
 
+        The completed requests can be delivered in batches: the callback is
+        called for `batch_size` requests in a row under a single acquisition
+        of the GIL. A batch is also delivered as soon as no other request of
+        the pool is running. The requests of the batch are not returned to the
+        pool until the callback has been called for all of them, so the
+        `batch_size` greater than the number of the jobs of the queue is
+        limited by it.
+
+        `request.shared_results` and `request.output_tensors[i].data` give
+        access to the outputs without copying them.
+
         :param callback: Any Python defined function that matches callback's requirements.
         :type callback: function
+        :param batch_size: Number of completed requests delivered to the callback
+                           under a single acquisition of the GIL. Default: 1
+        :type batch_size: int
     )");
 
     cls.def(
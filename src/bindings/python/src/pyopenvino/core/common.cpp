@@ -4,6 +4,8 @@
 
 #include "common.hpp"
 
+#include <ie_blob.h>
+
 #include <unordered_map>
 
 #include "openvino/util/common_util.hpp"
@@ -60,6 +62,79 @@ ov::Tensor tensor_from_pointer(py::array& array, const ov::Shape& shape) {
     }
 }
 
+namespace {
+
+// Blob on top of the memory of the numpy array, it keeps the array alive while any Tensor or InferRequest uses
+// the blob. The memory is preallocated, so the blob can't be enlarged by setShape, the same as any Tensor on top
+// of a host pointer
+template <typename T>
+class NumpyBlob : public InferenceEngine::TBlob<T> {
+public:
+    NumpyBlob(const InferenceEngine::TensorDesc& desc, const py::array& array)
+        : InferenceEngine::TBlob<T>(desc, static_cast<T*>(const_cast<void*>(array.data())), array.size()),
+          _array(array) {}
+
+    ~NumpyBlob() override {
+        // the last reference may be released by a thread which doesn't hold the GIL
+        if (Py_IsInitialized()) {
+            py::gil_scoped_acquire acquire;
+            _array.release().dec_ref();
+        } else {
+            _array.release();
+        }
+    }
+
+private:
+    py::array _array;
+};
+
+// The Tensor constructor from the blob is protected
+class NumpyTensor : public ov::Tensor {
+public:
+    explicit NumpyTensor(const std::shared_ptr<InferenceEngine::Blob>& blob) : ov::Tensor(blob, nullptr) {}
+};
+
+template <InferenceEngine::Precision::ePrecision precision>
+ov::Tensor tensor_sharing_numpy(const py::array& array, const std::vector<size_t>& shape) {
+    using value_type = typename InferenceEngine::PrecisionTrait<precision>::value_type;
+    InferenceEngine::TensorDesc desc(precision, shape, InferenceEngine::TensorDesc::getLayoutByRank(shape.size()));
+    return NumpyTensor(std::make_shared<NumpyBlob<value_type>>(desc, array));
+}
+
+ov::Tensor tensor_sharing_numpy(const py::array& array, const ov::element::Type& type, const std::vector<size_t>& shape) {
+    using InferenceEngine::Precision;
+    switch (type) {
+    case ov::element::Type_t::f16:
+        return tensor_sharing_numpy<Precision::FP16>(array, shape);
+    case ov::element::Type_t::f32:
+        return tensor_sharing_numpy<Precision::FP32>(array, shape);
+    case ov::element::Type_t::f64:
+        return tensor_sharing_numpy<Precision::FP64>(array, shape);
+    case ov::element::Type_t::i8:
+        return tensor_sharing_numpy<Precision::I8>(array, shape);
+    case ov::element::Type_t::i16:
+        return tensor_sharing_numpy<Precision::I16>(array, shape);
+    case ov::element::Type_t::i32:
+        return tensor_sharing_numpy<Precision::I32>(array, shape);
+    case ov::element::Type_t::i64:
+        return tensor_sharing_numpy<Precision::I64>(array, shape);
+    case ov::element::Type_t::u8:
+        return tensor_sharing_numpy<Precision::U8>(array, shape);
+    case ov::element::Type_t::u16:
+        return tensor_sharing_numpy<Precision::U16>(array, shape);
+    case ov::element::Type_t::u32:
+        return tensor_sharing_numpy<Precision::U32>(array, shape);
+    case ov::element::Type_t::u64:
+        return tensor_sharing_numpy<Precision::U64>(array, shape);
+    case ov::element::Type_t::boolean:
+        return tensor_sharing_numpy<Precision::BOOL>(array, shape);
+    default:
+        throw ov::Exception("Tensor with shared memory can't be created for the type " + type.get_type_name());
+    }
+}
+
+}  // namespace
+
 ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory) {
     // Check if passed array has C-style contiguous memory layout.
     bool is_contiguous = C_CONTIGUOUS == (array.flags() & C_CONTIGUOUS);
@@ -71,8 +146,7 @@ ov::Tensor tensor_from_numpy(py::array& array, bool shared_memory) {
     // users on their side of the code.
     if (shared_memory) {
         if (is_contiguous) {
-            std::vector<size_t> strides(array.strides(), array.strides() + array.ndim());
-            return ov::Tensor(type, shape, const_cast<void*>(array.data(0)), strides);
+            return tensor_sharing_numpy(array, type, shape);
         } else {
             throw ov::Exception("Tensor with shared memory must be C contiguous!");
         }
@@ -440,10 +514,28 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::array array_from_tensor_shared(const ov::Tensor& tensor) {
+    // the copy of the tensor owned by the array keeps the memory alive, even if the request is destroyed
+    return py::array(Common::ov_type_to_dtype().at(tensor.get_element_type()),
+                     tensor.get_shape(),
+                     tensor.get_strides(),
+                     tensor.data(),
+                     py::cast(tensor));
+}
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        // the types which have no exact numpy counterpart are always converted to the copies
+        const auto& type = t.get_element_type();
+        if (share_outputs && type != ov::element::bf16 && type != ov::element::u1 &&
+            Common::ov_type_to_dtype().count(type)) {
+            res[py::cast(out)] = array_from_tensor_shared(t);
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
@@ -53,7 +53,13 @@ PyAny from_ov_any(const ov::Any& any);
 
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
+py::array array_from_tensor_shared(const ov::Tensor& tensor);
+
+// If share_outputs is true, the arrays are views of the output tensors instead of copies,
+// so their content is overwritten by the next inference of the request.
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs = false);
 
 // Use only with classes that are not creatable by users on Python's side, because
 // Objects created in Python that are wrapped with such wrapper will cause memory leaks.
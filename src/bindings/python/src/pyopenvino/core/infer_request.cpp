@@ -160,16 +160,17 @@ void regclass_InferRequest(py::module m) {
 
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
             self._start_time = Time::now();
             self._request.infer();
             self._end_time = Time::now();
-            return Common::outputs_to_dict(self._outputs, self._request);
+            return Common::outputs_to_dict(self._outputs, self._request, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -177,6 +178,10 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, results are numpy views of the output tensors
+                                  without copying. The content of the views is overwritten
+                                  by the next inference of this InferRequest.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -635,6 +640,20 @@ void regclass_InferRequest(py::module m) {
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
 
+    cls.def_property_readonly(
+        "shared_results",
+        [](InferRequestWrapper& self) {
+            return Common::outputs_to_dict(self._outputs, self._request, true);
+        },
+        R"(
+            Gets all outputs tensors of this InferRequest as numpy views without copying.
+            The content of the views is overwritten by the next inference of this InferRequest,
+            so copy the data which is needed longer.
+
+            :return: Dictionary of results from output tensors with ports as keys.
+            :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
+        )");
+
     cls.def("__repr__", [](const InferRequestWrapper& self) {
         auto inputs_str = Common::docs::container_to_string(self._inputs, ",\n");
         auto outputs_str = Common::docs::container_to_string(self._outputs, ",\n");
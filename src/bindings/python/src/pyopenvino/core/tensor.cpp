@@ -27,8 +27,8 @@ void regclass_Tensor(py::module m) {
                 :param array: Array to create tensor from.
                 :type array: numpy.array
                 :param shared_memory: If `True`, this Tensor memory is being shared with a host,
-                                      that means the responsibility of keeping host memory is
-                                      on the side of a user. Any action performed on the host
+                                      the array is kept alive while this Tensor or any
+                                      InferRequest uses its memory. Any action performed on the host
                                       memory is reflected on this Tensor's memory!
                                       If `False`, data is being copied to this Tensor.
                                       Requires data to be C_CONTIGUOUS if `True`.
@@ -427,6 +427,133 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("batch_size", [1, 3, 16])
+def test_infer_queue_batched_callback(device, batch_size):
+    jobs = 10
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 4)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        # copy the data, the view is overwritten by the next inference of the request
+        results[job_id] = np.copy(list(request.shared_results.values())[0])
+
+    infer_queue.set_callback(callback, batch_size=batch_size)
+    inputs = [np.arange(-5, 5, dtype=np.float32) * i for i in range(jobs)]
+    for i in range(jobs):
+        infer_queue.start_async({0: inputs[i]}, i)
+    infer_queue.wait_all()
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.maximum(inputs[i], 0))
+
+
+def test_infer_queue_batched_callback_larger_than_pool(device):
+    jobs = 4
+    niter = 25
+    batch_size = 3 * jobs
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, jobs)
+    results = [None] * niter
+    delivered = []
+
+    def callback(request, job_id):
+        results[job_id] = np.copy(list(request.shared_results.values())[0])
+        delivered.append(job_id)
+
+    # the batch is limited by the pool size, so the results are delivered while the new jobs are started
+    infer_queue.set_callback(callback, batch_size=batch_size)
+    inputs = [np.arange(-5, 5, dtype=np.float32) * i for i in range(niter)]
+    for i in range(niter):
+        infer_queue.start_async({0: inputs[i]}, i)
+        if i >= jobs:
+            assert len(delivered) >= i + 1 - jobs
+    infer_queue.wait_all()
+    assert sorted(delivered) == list(range(niter))
+    for i in range(niter):
+        assert np.array_equal(results[i], np.maximum(inputs[i], 0))
+
+
+def test_infer_queue_batched_callback_zero_batch(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 2)
+
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.set_callback(lambda request, userdata: None, batch_size=0)
+    assert "batch size must be greater than 0" in str(e.value)
+
+
+def test_infer_share_outputs(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    request = compiled.create_infer_request()
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    res = request.infer({0: data}, share_outputs=True)
+    output = res[compiled.outputs[0]]
+    assert np.shares_memory(output, request.get_output_tensor().data)
+    assert np.array_equal(output, np.maximum(data, 0))
+    res = request.infer({0: data})
+    assert not np.shares_memory(res[compiled.outputs[0]], request.get_output_tensor().data)
+
+
+def test_infer_shared_memory_inputs(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    request = compiled.create_infer_request()
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    request.infer({0: data})
+    assert np.shares_memory(request.get_input_tensor().data, data)
+    # the request keeps the shared array alive
+    del data
+    res = request.infer()
+    assert np.array_equal(res[compiled.outputs[0]], np.maximum(np.arange(-5, 5, dtype=np.float32), 0))
+
+    # arrays of another data type are copied
+    data = np.arange(-5, 5, dtype=np.float64)
+    request.infer({0: data})
+    assert not np.shares_memory(request.get_input_tensor().data, data)
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    request.infer({0: data}, shared_memory=False)
+    assert not np.shares_memory(request.get_input_tensor().data, data)
+
+
+def test_infer_shared_memory_writes_reach_array(device):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled = core.compile_model(model, device)
+    request = compiled.create_infer_request()
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    request.infer({0: data})
+    request.get_input_tensor().data[:] = 7
+    assert np.array_equal(data, np.full(10, 7, dtype=np.float32))
+    # the changes of the array are seen by the next inference
+    data[:] = -data
+    res = request.infer()
+    assert np.array_equal(res[compiled.outputs[0]], np.zeros(10, dtype=np.float32))
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    request.infer({0: data}, shared_memory=False)
+    request.get_input_tensor().data[:] = 7
+    assert np.array_equal(data, np.arange(-5, 5, dtype=np.float32))
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
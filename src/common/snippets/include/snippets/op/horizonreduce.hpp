@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "snippets/op/reduce.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface HorizonReduce
+ * @brief Generated by code generator to reduce the vector accumulator of the Reduce operation into its first lane
+ * @ingroup snippets
+ */
+class HorizonReduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("HorizonReduce", "SnippetsOpset");
+
+    HorizonReduce(Reduce::Kind kind);
+    HorizonReduce() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<HorizonReduce>(m_kind);
+    }
+
+    Reduce::Kind get_kind() const {
+        return m_kind;
+    }
+
+private:
+    Reduce::Kind m_kind = Reduce::Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
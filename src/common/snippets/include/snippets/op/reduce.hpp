@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Reduce
+ * @brief Reduces the input along the innermost dimension, the output has the innermost dimension equal to 1.
+ * Generated by decomposition of the normalization operations (Softmax, MVN). Code generator computes every reduction
+ * in a separate pass over the row, so the result is available for all the row elements in the next passes.
+ * @ingroup snippets
+ */
+class Reduce : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Reduce", "SnippetsOpset");
+
+    enum class Kind {
+        Sum,
+        Max
+    };
+
+    Reduce(const Output<Node>& x, Kind kind);
+    Reduce() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    void validate_and_infer_types() override;
+
+    Kind get_kind() const {
+        return m_kind;
+    }
+
+    /**
+     * @brief returns the initial value of the accumulator: 0 for sum and the lowest float for max
+     */
+    float get_identity() const;
+
+private:
+    Kind m_kind = Kind::Sum;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
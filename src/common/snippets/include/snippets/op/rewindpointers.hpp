@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface RewindPointers
+ * @brief Generated by code generator to move the data pointers back to the row beginning after the reduction pass,
+ * since the loads always increment the pointers they read from
+ * @ingroup snippets
+ */
+class RewindPointers : public ngraph::op::Op {
+public:
+    OPENVINO_OP("RewindPointers", "SnippetsOpset");
+
+    RewindPointers(const std::vector<size_t>& effective_addresses);
+    RewindPointers() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
+        return std::make_shared<RewindPointers>(effective_addresses);
+    }
+
+    std::vector<size_t> effective_addresses;
+    const void *compile_params = nullptr;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
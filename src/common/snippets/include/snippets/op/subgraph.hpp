@@ -97,6 +97,9 @@ public:
     snippets::Schedule generate(const void* compile_params = nullptr);
     Shape canonicalize(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes);
 
+    // true if the body reduces along the innermost dimension, so the dimension must be kept intact by a scheduler
+    bool has_reductions() const;
+
     // plugin sets generator for a snippet to some specific generator.
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ngraph::snippets::Generator> generator);
@@ -0,0 +1,34 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface DecomposeReductions
+ * @brief Decomposes Softmax and MVN along the innermost axis into snippets::op::Reduce and elementwise operations,
+ * so the whole normalization is generated as a single kernel. Should be applied after canonicalization,
+ * since MVN mean and variance are scaled by the static innermost dimension.
+ * @ingroup snippets
+ */
+class DecomposeReductions: public ngraph::pass::MatcherPass {
+public:
+    DecomposeReductions();
+
+    /**
+     * @brief checks if the node is a normalization the pass is able to decompose
+     * @return true, if Softmax or MVN reduces the innermost axis only
+     */
+    static bool is_supported(const std::shared_ptr<const Node>& node);
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
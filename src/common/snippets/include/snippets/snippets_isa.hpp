@@ -11,6 +11,7 @@
 #include "op/blockedparameter.hpp"
 #include "op/broadcastload.hpp"
 #include "op/broadcastmove.hpp"
+#include "op/horizonreduce.hpp"
 #include "op/kernel.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
@@ -18,6 +19,8 @@
 #include "op/scalarload.hpp"
 #include "op/scalarstore.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
+#include "op/rewindpointers.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
 #include "op/vectorload.hpp"
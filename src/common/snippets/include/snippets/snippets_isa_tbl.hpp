@@ -23,6 +23,7 @@ NGRAPH_OP(VectorStore, ngraph::snippets::op)
 NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
+NGRAPH_OP(Reduce, ngraph::snippets::op)
 
 // Layout-oblivious from opset1
 
@@ -8,10 +8,17 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/op/horizonreduce.hpp"
+#include "snippets/op/rewindpointers.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+#include <functional>
+#include <set>
+#include <unordered_set>
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -38,6 +45,34 @@ auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph:
     return std::make_pair(rin, rout);
 }
 
+namespace {
+using LoweredCode = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+
+// Collects the ops the given outputs depend on within the same row pass. The traversal stops at the reductions,
+// since their results are computed by the previous passes and kept in the registers.
+auto get_pass_ops(const ov::NodeVector& ordered_ops, const ov::NodeVector& roots) -> ov::NodeVector {
+    std::unordered_set<ngraph::Node*> visited;
+    std::vector<ngraph::Node*> stack;
+    for (const auto& root : roots) {
+        visited.insert(root.get());
+        stack.push_back(root.get());
+    }
+    while (!stack.empty()) {
+        auto node = stack.back();
+        stack.pop_back();
+        for (const auto& input : node->input_values()) {
+            auto parent = input.get_node();
+            if (!ov::is_type<ngraph::snippets::op::Reduce>(parent) && visited.insert(parent).second)
+                stack.push_back(parent);
+        }
+    }
+    ov::NodeVector pass_ops;
+    std::copy_if(ordered_ops.begin(), ordered_ops.end(), std::back_inserter(pass_ops),
+                 [&visited](const std::shared_ptr<ngraph::Node>& n) { return visited.count(n.get()); });
+    return pass_ops;
+}
+} // namespace
+
 ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov::Model>& m,
                                                              const void* compile_params) const {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator::generate")
@@ -50,42 +85,97 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     auto out = results.size();
     auto nptrs = in + out;
 
-    OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
-    // vector tile
-    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> lowered;
-    for (auto n : m->get_ordered_ops()) {
-        lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
-    }
-    OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
-
+    OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::ScalarTile")
     // scalar tile
-    auto m_scalar = ov::clone_model(*m.get());
+    std::unordered_map<ngraph::Node*, std::shared_ptr<ngraph::Node>> scalar_map;
+    auto m_scalar = ov::clone_model(*m.get(), scalar_map);
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
     mng.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
     mng.run_passes(m_scalar);
-    OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
-        scalar_lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
-    }
-    OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D")
 
+    OV_ITT_TASK_NEXT(GENERATE, "::Passes")
+    // The row is processed in several passes if the body has reductions: every pass computes a reduction
+    // (the ops it depends on are recomputed), and the last pass computes and stores the results.
+    // Without reductions the body is processed in a single pass.
+    const auto ops = m->get_ordered_ops();
+    const auto scalar_ops = m_scalar->get_ordered_ops();
+    ov::NodeVector reductions;
+    std::copy_if(ops.begin(), ops.end(), std::back_inserter(reductions),
+                 [](const std::shared_ptr<ngraph::Node>& n) { return ov::is_type<ngraph::snippets::op::Reduce>(n); });
+
+    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> all_lowered;
+    auto lower = [&](const ov::NodeVector& pass_ops) {
+        LoweredCode lowered;
+        for (auto n : pass_ops) {
+            lowered.push_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
+        }
+        all_lowered.insert(all_lowered.end(), lowered.begin(), lowered.end());
+        return lowered;
+    };
+    auto make_emitter = [&](const std::shared_ptr<ngraph::Node>& n, const RegInfo& regs) {
+        auto emitter = std::make_pair(target->get(n->get_type_info())(n), regs);
+        all_lowered.push_back(emitter);
+        return emitter;
+    };
     // wrapping into tiles1D
-    std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles1D;
-    auto tile = std::make_shared<ngraph::snippets::op::Tile>(lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                                   std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
-    tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered);
-    tile->compile_params = compile_params;
-    tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
-                    std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    LoweredCode tiles1D;
+    auto wrap_into_tiles = [&](const ov::NodeVector& pass_ops, const ov::NodeVector& scalar_pass_ops,
+                               const std::function<void()>& between_tiles) {
+        auto tile = std::make_shared<ngraph::snippets::op::Tile>(lower(pass_ops));
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                                       std::make_pair(std::vector<size_t>({target->get_lanes(), 0, nptrs, 1}), std::vector<size_t>{})));
+        between_tiles();
+        tile = std::make_shared<ngraph::snippets::op::Tile>(lower(scalar_pass_ops));
+        tile->compile_params = compile_params;
+        tiles1D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                        std::make_pair(std::vector<size_t>{{1, target->get_lanes(), nptrs, 1}}, std::vector<size_t>{})));
+    };
+
+    for (auto reduction : reductions) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::Reduce>(reduction);
+        const auto scalar_reduction = scalar_map.at(reduction.get());
+        const auto pass_ops = get_pass_ops(ops, {reduction});
+        const auto acc = getRegisters(reduction).second;
+
+        // the accumulator is initialized by the reduction identity, the vector tile accumulates the lanes
+        // which are reduced to the first one, then the scalar tile accumulates the tail
+        auto identity = std::make_shared<ngraph::snippets::op::Scalar>(ngraph::element::f32, Shape{1}, reduce->get_identity());
+        tiles1D.push_back(make_emitter(identity, std::make_pair(std::vector<size_t>{}, acc)));
+        wrap_into_tiles(pass_ops, get_pass_ops(scalar_ops, {scalar_reduction}), [&]() {
+            auto horizon = std::make_shared<ngraph::snippets::op::HorizonReduce>(reduce->get_kind());
+            tiles1D.push_back(make_emitter(horizon, std::make_pair(acc, acc)));
+        });
+        // the placeholder input makes the emitter broadcast the first lane to the whole register
+        auto broadcast = std::make_shared<ngraph::snippets::op::BroadcastMove>(
+            std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, Shape{1}), Shape{target->get_lanes()});
+        tiles1D.push_back(make_emitter(broadcast, std::make_pair(acc, acc)));
+
+        // the loads incremented the pointers by the row size, so they are moved back for the next pass
+        std::set<size_t> effective_addresses;
+        for (const auto& n : pass_ops) {
+            if (ov::is_type<ngraph::snippets::op::Load>(n) && n->get_input_shape(0).back() != 1) {
+                effective_addresses.insert(n->get_rt_info().at("effectiveAddress").as<int64_t>());
+            }
+        }
+        auto rewind = std::make_shared<ngraph::snippets::op::RewindPointers>(
+            std::vector<size_t>(effective_addresses.begin(), effective_addresses.end()));
+        rewind->compile_params = compile_params;
+        tiles1D.push_back(make_emitter(rewind, std::make_pair(std::vector<size_t>{}, std::vector<size_t>{})));
+    }
+
+    ov::NodeVector scalar_results;
+    for (const auto& result : m_scalar->get_results())
+        scalar_results.push_back(result);
+    wrap_into_tiles(reductions.empty() ? ops : get_pass_ops(ops, ov::NodeVector(results.begin(), results.end())),
+                    reductions.empty() ? scalar_ops : get_pass_ops(scalar_ops, scalar_results),
+                    []() {});
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
     std::vector<std::pair<std::shared_ptr<Emitter>, RegInfo>> tiles2D;
-    tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
+    auto tile = std::make_shared<ngraph::snippets::op::Tile>(tiles1D);
     tile->compile_params = compile_params;
     tiles2D.push_back(std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
                                      std::make_pair(std::vector<size_t>({1, 0, nptrs, 0}), std::vector<size_t>{})));
@@ -97,8 +187,7 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     std::shared_ptr<Emitter> kernel = target->get(ngraph::snippets::op::Kernel::get_type_info_static())(tiles2DKernel);
     kernel->emit_code({in, out}, {});
     OV_ITT_TASK_NEXT(GENERATE, "::EmitData")
-    lowered.insert(lowered.end(), scalar_lowered.begin(), scalar_lowered.end());
-    for (auto& op : lowered) {
+    for (auto& op : all_lowered) {
         op.first->emit_data();
     }
     OV_ITT_TASK_NEXT(GENERATE, "::GetSnippet")
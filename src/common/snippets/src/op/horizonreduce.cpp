@@ -0,0 +1,11 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/horizonreduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::HorizonReduce::HorizonReduce(Reduce::Kind kind) : Op(), m_kind(kind) {
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reduce.hpp"
+
+#include <limits>
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Reduce::Reduce(const Output<Node>& x, Kind kind) : Op({x}), m_kind(kind) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::Reduce::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+std::shared_ptr<Node> snippets::op::Reduce::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(Reduce);
+    check_new_args_count(this, new_args);
+    return std::make_shared<Reduce>(new_args.at(0), m_kind);
+}
+
+void snippets::op::Reduce::validate_and_infer_types() {
+    const auto& input_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, input_shape.rank().is_static() && input_shape.rank().get_length() > 0,
+                          "Reduce expects the input of static non-zero rank");
+    auto output_shape = input_shape;
+    output_shape[output_shape.size() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+float snippets::op::Reduce::get_identity() const {
+    return m_kind == Kind::Sum ? 0.f : std::numeric_limits<float>::lowest();
+}
@@ -0,0 +1,11 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/op/rewindpointers.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::RewindPointers::RewindPointers(const std::vector<size_t>& addresses) : Op(), effective_addresses(addresses) {
+}
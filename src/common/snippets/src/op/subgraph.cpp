@@ -12,6 +12,7 @@
 #include "snippets/pass/assign_registers.hpp"
 #include "snippets/pass/convert_constants_to_scalars.hpp"
 #include "snippets/pass/convert_power_to_powerstatic.hpp"
+#include "snippets/pass/decompose_reductions.hpp"
 #include "snippets/pass/vector_to_scalar.hpp"
 
 #include <ngraph/pass/manager.hpp>
@@ -175,8 +176,9 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
+        // the body of a dynamic subgraph has dynamic parameters until canonicalization
+        const auto& paramShape = m_body->get_parameters()[i]->get_partial_shape();
+        if (paramShape.is_dynamic() || paramShape.get_shape() != inShape)
                 m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
     }
 
@@ -217,6 +219,13 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
     return exec_domain;
 }
 
+bool snippets::op::Subgraph::has_reductions() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& n) {
+        return ov::is_type<op::Reduce>(n) || snippets::pass::DecomposeReductions::is_supported(n);
+    });
+}
+
 void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
@@ -224,6 +233,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         return n->get_input_shape(0).back() != 1;
     };
     ngraph::pass::Manager manager;
+    manager.register_pass<snippets::pass::DecomposeReductions>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>();
@@ -108,13 +108,27 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         live_intervals.insert(std::make_pair(i, find_last_use(i)));
     }
 
+    // Reduction results are computed in the separate passes over the row, and the operations are recomputed in every pass,
+    // so the linear scan over the whole body can't tell their lifetime. Dedicated registers are reserved from the end of the bank.
+    const size_t num_vec_regs = 16;
+    std::map<Reg, Reg> register_map;
+    size_t num_reserved = 0;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (ov::is_type<snippets::op::Reduce>(stmts[i])) {
+            if (num_reserved == num_vec_regs)
+                throw ngraph_error("cannot reserve registers for reductions in a snippet");
+            register_map[i] = num_vec_regs - 1 - num_reserved++;
+        }
+    }
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
     std::multiset<std::pair<int, int>, by_ending> active;
-    std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
-    for (int i = 0; i < 16; i++) bank.push(16-1-i);
+    for (size_t i = num_reserved; i < num_vec_regs; i++) bank.push(num_vec_regs-1-i);
 
     for (auto interval : live_intervals) {
+        if (register_map.count(interval.first))
+            continue;
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -125,7 +139,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (active.size() == num_vec_regs - num_reserved) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
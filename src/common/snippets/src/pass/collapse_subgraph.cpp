@@ -7,6 +7,7 @@
 
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/op/subgraph.hpp"
+#include "snippets/pass/decompose_reductions.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
@@ -31,6 +32,12 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // dynamic output shapes can't be checked in advance, so only a single output is allowed
+    const bool is_dynamic = std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& out) {
+        return out.get_partial_shape().is_dynamic();
+    });
+    if (is_dynamic)
+        return outputs.size() != 1;
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -103,7 +110,11 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
         return t.get_element_type() == ngraph::element::f32 &&
-               t.get_partial_shape().is_static();
+               t.get_partial_shape().rank().is_static();
+    };
+    // MVN axes are the constant attribute rather than the data, they are checked by DecomposeReductions::is_supported
+    auto is_data_input = [&n](const Input<const Node>& in) -> bool {
+        return !(ov::is_type<ov::op::v6::MVN>(n) && in.get_index() == 1);
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -115,7 +126,7 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return !is_data_input(in) || supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -162,7 +173,7 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || DecomposeReductions::is_supported(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -481,6 +492,18 @@ TokenizeSnippets::TokenizeSnippets() {
             return abort_with_strategy(message_reset, message_abort);
         }
 
+        // every reduction keeps its accumulators in the dedicated vector registers for the whole kernel
+        const size_t max_reductions = 2;
+        size_t num_reductions = DecomposeReductions::is_supported(node) ? 1 : 0;
+        for (const auto& subgraph : input_subgraphs) {
+            const auto& ops = clones[subgraph]->get_ops();
+            num_reductions += std::count_if(ops.begin(), ops.end(), DecomposeReductions::is_supported);
+        }
+        if (num_reductions > max_reductions) {
+            return abort_with_strategy("new subgraph is created since too many reductions are detected",
+                                       "failed to continue subgraph since too many reductions are detected");
+        }
+
         auto body = op::create_body(newSubgraphName, body_results, body_parameters);
         for (size_t i = 0; i < body->get_parameters().size(); i++) {
             body->get_parameters()[i]->set_friendly_name(body_parameters[i]->get_friendly_name());
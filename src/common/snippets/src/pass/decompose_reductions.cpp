@@ -0,0 +1,93 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+#include "snippets/snippets_isa.hpp"
+#include "snippets/pass/decompose_reductions.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+bool ngraph::snippets::pass::DecomposeReductions::is_supported(const std::shared_ptr<const Node>& node) {
+    // also called for every op of a subgraph body, including the ones without inputs
+    if (!ov::is_type<ov::op::v1::Softmax>(node) && !ov::is_type<ov::op::v8::Softmax>(node) && !ov::is_type<ov::op::v6::MVN>(node))
+        return false;
+    const auto& input_shape = node->get_input_partial_shape(0);
+    if (input_shape.rank().is_dynamic() || input_shape.rank().get_length() == 0)
+        return false;
+    const auto rank = input_shape.rank().get_length();
+    auto is_innermost = [rank](int64_t axis) {
+        return (axis < 0 ? axis + rank : axis) == rank - 1;
+    };
+
+    if (const auto softmax = ov::as_type_ptr<const ov::op::v1::Softmax>(node))
+        return is_innermost(static_cast<int64_t>(softmax->get_axis()));
+    if (const auto softmax = ov::as_type_ptr<const ov::op::v8::Softmax>(node))
+        return is_innermost(softmax->get_axis());
+    if (const auto mvn = ov::as_type_ptr<const ov::op::v6::MVN>(node)) {
+        // the mean and the variance are scaled by the row size, which is a constant of the generated code
+        if (input_shape[rank - 1].is_dynamic())
+            return false;
+        const auto axes = ov::as_type_ptr<const ov::op::v0::Constant>(mvn->get_input_node_shared_ptr(1));
+        if (!axes)
+            return false;
+        const auto values = axes->cast_vector<int64_t>();
+        return values.size() == 1 && is_innermost(values[0]);
+    }
+    return false;
+}
+
+ngraph::snippets::pass::DecomposeReductions::DecomposeReductions() {
+    MATCHER_SCOPE(DecomposeReductions);
+    auto reduction = ngraph::pattern::wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax, ov::op::v6::MVN>(
+        [](const Output<Node>& out) { return is_supported(out.get_node_shared_ptr()); });
+
+    ngraph::graph_rewrite_callback callback = [this](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::DecomposeReductions")
+        auto root = m.get_match_root();
+        const auto data = root->input_value(0);
+        const auto row_size = static_cast<float>(data.get_shape().back());
+        auto scalar = [](float value) {
+            return opset1::Constant::create(element::f32, Shape{}, {value});
+        };
+
+        NodeVector decomposition;
+        auto make = [&decomposition](std::shared_ptr<Node> node) {
+            decomposition.push_back(node);
+            return node;
+        };
+
+        std::shared_ptr<Node> result;
+        if (const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(root)) {
+            const auto sum = make(std::make_shared<op::Reduce>(data, op::Reduce::Kind::Sum));
+            const auto mean = make(std::make_shared<opset1::Multiply>(sum, scalar(1.f / row_size)));
+            const auto centered = make(std::make_shared<opset1::Subtract>(data, mean));
+            result = centered;
+            if (mvn->get_normalize_variance()) {
+                const auto squared = make(std::make_shared<opset1::Multiply>(centered, centered));
+                const auto squared_sum = make(std::make_shared<op::Reduce>(squared, op::Reduce::Kind::Sum));
+                const auto variance = make(std::make_shared<opset1::Multiply>(squared_sum, scalar(1.f / row_size)));
+                const auto eps = scalar(mvn->get_eps());
+                const auto denominator = mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT ?
+                    make(std::make_shared<opset1::Sqrt>(make(std::make_shared<opset1::Add>(variance, eps)))) :
+                    make(std::make_shared<opset1::Add>(make(std::make_shared<opset1::Sqrt>(variance)), eps));
+                result = make(std::make_shared<opset1::Divide>(centered, denominator));
+            }
+        } else {
+            // Softmax is computed with the maximum subtracted to avoid the exponent overflow
+            const auto max = make(std::make_shared<op::Reduce>(data, op::Reduce::Kind::Max));
+            const auto shifted = make(std::make_shared<opset1::Subtract>(data, max));
+            const auto exp = make(std::make_shared<opset1::Exp>(shifted));
+            const auto sum = make(std::make_shared<op::Reduce>(exp, op::Reduce::Kind::Sum));
+            result = make(std::make_shared<opset1::Divide>(exp, sum));
+        }
+
+        result->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, decomposition);
+        ngraph::replace_node(root, result);
+        return true;
+    };
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(reduction), callback);
+}
@@ -14,6 +14,7 @@ ov::pass::Attributes::Attributes() {
     register_factory<OldApiMapElementType>();
     register_factory<LayoutAttribute>();
     register_factory<Decompression>();
+    register_factory<KeepConstPrecision>();
     register_factory<ov::preprocess::TensorInfoMemoryType>();
     register_factory<StridesPropagation>();
     register_factory<PreprocessingAttribute>();
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only view of a file mapped into the process memory.
+ * The pages are loaded lazily on the first access and are shared between all processes which map the same file.
+ * Writes to the mapped memory are private to the process (copy-on-write) and never reach the file.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped file content
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns a size of the mapped file content in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into the process memory.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the mapping is released with the last reference
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into the process memory.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the mapping is released with the last reference
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
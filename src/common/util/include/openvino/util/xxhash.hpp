@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+/// \brief Computes the non-cryptographic 64-bit hash of the data by the xxHash64 algorithm, the result matches
+///        the reference implementation. The four independent 64-bit lanes are not limited by the multiplication
+///        latency, so the hash costs about one pass over the memory.
+/// \param data The pointer to the data.
+/// \param size The size of the data in bytes.
+/// \param seed The seed of the hash.
+/// \return Returns the hash of the data.
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+}  // namespace util
+}  // namespace ov
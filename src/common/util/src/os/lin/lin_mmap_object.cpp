@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+
+class HandleHolder {
+    int m_handle = -1;
+
+public:
+    explicit HandleHolder(int handle = -1) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        if (m_handle != -1) {
+            ::close(m_handle);
+        }
+    }
+
+    int get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+    MapHolder(const MapHolder&) = delete;
+    MapHolder& operator=(const MapHolder&) = delete;
+
+    void set(const std::string& path) {
+        HandleHolder handle(::open(path.c_str(), O_RDONLY));
+        if (handle.get() == -1) {
+            throw std::runtime_error("Cannot open file " + path + " for mapping: " + std::strerror(errno));
+        }
+
+        struct stat sb = {};
+        if (::fstat(handle.get(), &sb) == -1) {
+            throw std::runtime_error("Cannot get size of file " + path + ": " + std::strerror(errno));
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size == 0) {
+            // an empty file can't be mapped
+            return;
+        }
+
+        // private writable mapping: the clean pages are shared with the page cache,
+        // while any modification of the data creates a private copy of the page
+        void* data = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, handle.get(), 0);
+        if (data == MAP_FAILED) {
+            m_size = 0;
+            throw std::runtime_error("Cannot map file " + path + ": " + std::strerror(errno));
+        }
+        m_data = static_cast<char*>(data);
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+// clang-format off
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+// clang-format on
+
+namespace ov {
+namespace util {
+
+class HandleHolder {
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+    MapHolder(const MapHolder&) = delete;
+    MapHolder& operator=(const MapHolder&) = delete;
+
+    void set(HANDLE file_handle, const std::string& path) {
+        HandleHolder file(file_handle);
+        if (file.get() == INVALID_HANDLE_VALUE) {
+            std::stringstream ss;
+            ss << "Cannot open file " << path << " for mapping: " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file.get(), &file_size)) {
+            std::stringstream ss;
+            ss << "Cannot get size of file " << path << ": " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size == 0) {
+            // an empty file can't be mapped
+            return;
+        }
+
+        HandleHolder mapping(::CreateFileMappingW(file.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+        if (mapping.get() == nullptr) {
+            m_size = 0;
+            std::stringstream ss;
+            ss << "Cannot create mapping of file " << path << ": " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+
+        // copy-on-write view: the clean pages are shared with the other processes mapping the file
+        m_data = static_cast<char*>(::MapViewOfFile(mapping.get(), FILE_MAP_COPY, 0, 0, m_size));
+        if (m_data == nullptr) {
+            m_size = 0;
+            std::stringstream ss;
+            ss << "Cannot map file " << path << ": " << ::GetLastError();
+            throw std::runtime_error(ss.str());
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(::CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr),
+                path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(::CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr),
+                ov::util::wstring_to_string(path));
+    return holder;
+}
+#endif
+
+}  // namespace util
+}  // namespace ov
@@ -71,5 +71,15 @@ void irdft_shape_infer(const ov::op::v9::IRDFT* op,
     }
 }
 }  // namespace util
+
+namespace v9 {
+template <class T>
+void shape_infer(const IRDFT* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    util::irdft_shape_infer(op, input_shapes, output_shapes, constant_data);
+}
+}  // namespace v9
 }  // namespace op
 }  // namespace ov
@@ -83,5 +83,15 @@ void rdft_shape_infer(const ov::op::v9::RDFT* op,
     output_shape[last_axis] = get_rdft_output_dimension(output_shape[last_axis]);
 }
 }  // namespace util
+
+namespace v9 {
+template <class T>
+void shape_infer(const RDFT* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    util::rdft_shape_infer(op, input_shapes, output_shapes, constant_data);
+}
+}  // namespace v9
 }  // namespace op
 }  // namespace ov
@@ -84,6 +84,26 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_shared_mapping) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    // both constants are views into the same mapping of the file, no copies of the data are made
+    std::map<std::string, std::shared_ptr<op::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<op::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("data_a"), 1);
+    ASSERT_EQ(constants.count("data_b"), 1);
+    const auto data_a = constants["data_a"]->get_data_ptr<char>();
+    const auto data_b = constants["data_b"]->get_data_ptr<char>();
+    EXPECT_EQ(data_b - data_a, 4096);
+    EXPECT_EQ(constants["data_a"]->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
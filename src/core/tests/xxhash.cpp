@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(xxhash, matches_reference) {
+    const char* text = "Nobody inspects the spammish repetition";
+    // 0, 3 and 39 bytes: the short input, the 4-byte lane and the 32-byte stripes followed by all the tails
+    EXPECT_EQ(0xEF46DB3751D8E999ull, ov::util::xxhash64("", 0));
+    EXPECT_EQ(0x44BC2CF5AD770999ull, ov::util::xxhash64("abc", 3));
+    EXPECT_EQ(0xFBCEA83C8A378BF1ull, ov::util::xxhash64(text, std::strlen(text)));
+}
+
+TEST(xxhash, depends_on_seed_and_each_byte) {
+    std::vector<unsigned char> data(100);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i);
+    const auto original = ov::util::xxhash64(data.data(), data.size());
+
+    EXPECT_NE(original, ov::util::xxhash64(data.data(), data.size(), 1));
+    for (size_t pos = 0; pos < data.size(); pos++) {
+        data[pos] ^= 1;
+        EXPECT_NE(original, ov::util::xxhash64(data.data(), data.size())) << "position " << pos;
+        data[pos] ^= 1;
+    }
+}
@@ -40,7 +40,8 @@ protected:
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
     /// \brief Reads model from file or std::istream
-    /// \param params Can be path to the model file or std::istream
+    /// \param params Can be path to the model file or std::istream, optionally followed by
+    /// path to the weights file or weights buffer and a bool flag which enables mmap of the weights file
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& params) const override;
 
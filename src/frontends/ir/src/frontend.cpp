@@ -12,6 +12,7 @@
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -115,6 +116,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ngraph::runtime::AlignedBuffer> weights;
+    bool enable_mmap = false;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -179,6 +181,8 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ngraph::runtime::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ngraph::runtime::AlignedBuffer>>();
+        } else if (variant.is<bool>()) {
+            enable_mmap = variant.as<bool>();
         }
     }
 
@@ -198,7 +202,20 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         }
     }
 
-    if (!weights_path.empty()) {
+    if (!weights_path.empty() && enable_mmap) {
+        // Constants point directly into the mapped file, the pages are loaded on the first access
+        std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+        try {
+            mapped_memory = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception& ex) {
+            IE_THROW() << "Weights file cannot be mapped! " << ex.what();
+        }
+
+        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+            mapped_memory->data(),
+            mapped_memory->size(),
+            mapped_memory);
+    } else if (!weights_path.empty()) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
@@ -16,6 +16,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
 #include "openvino/frontend/extension/holder.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -49,10 +50,15 @@ public:
         return m_extensions;
     }
 
+    const detail::MappedMemoryHandles& get_mmap_cache() const {
+        return m_mmap_cache;
+    }
+
 protected:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          detail::MappedMemoryHandles mmap_cache = nullptr);
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
 
@@ -67,6 +73,7 @@ protected:
     std::unique_ptr<Model> m_model;
     std::unique_ptr<GraphCache> m_cache;
     ov::frontend::ExtensionHolder m_extensions = {};
+    detail::MappedMemoryHandles m_mmap_cache;
 
 private:
     std::vector<Node> m_nodes;
@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -340,9 +341,11 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const detail::MappedMemoryHandles& mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_mmap_cache{mmap_cache} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -457,9 +460,27 @@ public:
     }
 
 private:
+    bool has_external_data() const {
+        return m_tensor_proto->has_data_location() &&
+               m_tensor_proto->data_location() ==
+                   ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
+    }
+
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (m_mmap_cache && has_external_data() && !m_tensor_proto->has_segment()) {
+            // the Constant shares the memory of the mapped file instead of copying the data,
+            // the copying path is used as a fallback for the data which can't be viewed in place
+            auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data(m_mmap_cache);
+            if (buffer->size() == shape_size(m_shape) * type.size() &&
+                reinterpret_cast<uintptr_t>(buffer->get_ptr()) % alignof(T) == 0) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+        }
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -468,6 +489,7 @@ private:
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -20,9 +20,9 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
@@ -44,16 +44,10 @@ std::string TensorExternalData::load_external_data() const {
     if (m_data_length == 0)  // read entire file
         read_data_length = external_data_stream.tellg();
     else
-        read_data_length = m_data_length;
+        read_data_length = static_cast<std::streamsize>(m_data_length);
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
     // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+    external_data_stream.seekg(static_cast<std::streamoff>(m_offset), std::ios::beg);
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
@@ -67,6 +61,40 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data(const MappedMemoryHandles& cache) const {
+    auto& mapped_memory = (*cache)[m_data_location];
+    if (!mapped_memory) {
+        // the whole file is mapped, so the tensor offsets don't need to be aligned to the page size
+        try {
+            NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
+#else
+            mapped_memory = ov::util::load_mmap_object(m_data_location);
+#endif
+            NGRAPH_SUPPRESS_DEPRECATED_END
+        } catch (const std::runtime_error&) {
+            cache->erase(m_data_location);
+            throw error::invalid_external_data{*this};
+        }
+    }
+
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset > file_size || m_data_length > file_size - m_offset) {
+        throw error::invalid_external_data{*this};
+    }
+    // read the rest of the file if the length is not specified
+    const uint64_t data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<MappedBuffer>(mapped_memory->data() + m_offset,
+                                          static_cast<size_t>(data_length),
+                                          mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,20 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +34,18 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map the external data file into memory and return a view of the tensor data
+    ///
+    /// \note       Each file is mapped once, the mapping is shared between all tensors
+    ///             stored in the file via the cache passed as an argument.
+    ///             If the file can't be mapped or the tensor doesn't fit in the file,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      cache  Mapped files of the model, keyed by the file location
+    ///
+    /// \return     Buffer pointing to the tensor data inside of the mapped file
+    std::shared_ptr<MappedBuffer> load_external_mmap_data(const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -30,8 +53,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
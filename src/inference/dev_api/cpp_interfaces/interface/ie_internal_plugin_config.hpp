@@ -53,6 +53,70 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables binding of variable states directly to the ReadValue/Assign memory of the CPU graph.
+ * The state values are double buffered and swapped after each inference instead of being copied (YES/NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ZERO_COPY_STATES);
+
+/**
+ * @brief Enables concurrent execution of the independent nodes of the CPU graph (YES/NO).
+ * The nodes are grouped into levels of mutually independent nodes, and the nodes of each level run in parallel
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_GRAPH_EXECUTION);
+
+/**
+ * @brief Places the dynamic shape tensors of the CPU graph to a single memory arena (YES/NO).
+ * The arena is planned by the memory solver (once per input shapes) like for the static shapes,
+ * so the tensors with non-overlapping lifetimes share the memory
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_REUSE);
+
+/**
+ * @brief Read-only metric with the peak size in bytes (uint64_t) of the memory of the dynamic shape tensors
+ * of the CPU network, see CPU_DYNAMIC_MEMORY_REUSE. With the reuse disabled the tensors are not sharing the memory,
+ * so the peak is the sum of their sizes
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_DYNAMIC_MEMORY_PEAK = "CPU_DYNAMIC_MEMORY_PEAK";
+
+/**
+ * @brief Defines the minimal fraction of zero weights (a float number in [0, 1]) for which the FullyConnected
+ * of the CPU plugin uses the sparse weights kernel. The weights are stored compressed, only the non-zero
+ * values are loaded and multiplied. The default value 1 disables the sparse weights kernel
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE);
+
+/**
+ * @brief Keeps the f16/u8/i8 weights of the memory bound MatMul operations (a few rows of the activations) compressed,
+ * so the FullyConnected of the CPU plugin decompresses them on the fly instead of the f32 oneDNN inner product (YES/NO).
+ * The post operations are not fused into such FullyConnected. Disabled by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_FC_WEIGHTS_DECOMPRESSION);
+
+/**
+ * @brief Defines the path of the file the execution timeline of the CPU network is written to in the Chrome trace
+ * event format (viewed by chrome://tracing or Perfetto): the time spans of the nodes per stream, of the infer requests
+ * and of the asynchronous pipeline stages. The file is written when the network is destroyed.
+ * The default empty value disables the tracing
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXECUTION_TRACE);
+
+/**
+ * @brief Defines the max number of the networks with the smaller (power-of-two) batch sizes compiled by the
+ *        AUTO_BATCH plugin to execute the partially collected batch on the time-out (rather than executing every
+ *        collected request with batch1). Each network costs the device memory and the compilation time.
+ *        The value is an unsigned int, 0 (default) disables the partial batches.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_PARTIAL_BATCH_NETWORKS);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines the stream buffer over the memory mapped file and the allocator exposing the mapped memory as a blob
+ * @file ie_shared_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <streambuf>
+
+#include "ie_allocator.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Read-only stream buffer over the memory mapped file, used e.g. to read the cached networks.
+ * The stream reads the data straight from the mapping, while a plugin aware of the buffer may access
+ * the mapped memory directly (without any copy):
+ * @code
+ * if (auto buffer = dynamic_cast<SharedStreamBuffer*>(stream.rdbuf())) {
+ *     const char* data = buffer->data() + stream.tellg();
+ * }
+ * @endcode
+ * @ingroup ie_dev_api_plugin_api
+ */
+class SharedStreamBuffer : public std::streambuf {
+public:
+    /**
+     * @brief Constructs the buffer over the mapped memory, the buffer keeps the mapping alive
+     * @param memory The mapped memory
+     */
+    explicit SharedStreamBuffer(std::shared_ptr<ov::util::MappedMemory> memory) : _memory(std::move(memory)) {
+        char* begin = _memory->data();
+        setg(begin, begin, begin + _memory->size());
+    }
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped memory
+     */
+    const char* data() const noexcept {
+        return eback();
+    }
+
+    /**
+     * @brief Returns a size of the mapped memory in bytes
+     */
+    size_t size() const noexcept {
+        return static_cast<size_t>(egptr() - eback());
+    }
+
+    /**
+     * @brief Returns the mapped memory, e.g. to share the ownership with the objects created from the data
+     */
+    const std::shared_ptr<ov::util::MappedMemory>& memory() const noexcept {
+        return _memory;
+    }
+
+protected:
+    std::streamsize showmanyc() override {
+        return egptr() - gptr();
+    }
+
+    std::streamsize xsgetn(char* s, std::streamsize count) override {
+        count = std::min<std::streamsize>(count, egptr() - gptr());
+        std::copy_n(gptr(), count, s);
+        setg(eback(), gptr() + count, egptr());
+        return count;
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        off_type base = 0;
+        if (dir == std::ios_base::cur)
+            base = gptr() - eback();
+        else if (dir == std::ios_base::end)
+            base = egptr() - eback();
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const off_type off = off_type(pos);
+        if (!(which & std::ios_base::in) || off < 0 || off > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + off, egptr());
+        return pos;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> _memory;
+};
+
+/**
+ * @brief Allocator which provides a region of the mapped memory as a blob memory, the allocator keeps the mapping alive
+ * @ingroup ie_dev_api_plugin_api
+ */
+class MappedMemoryAllocator : public IAllocator {
+public:
+    /**
+     * @brief Constructs the allocator over the mapped memory region
+     * @param memory The mapped memory
+     * @param offset The region offset in bytes
+     */
+    explicit MappedMemoryAllocator(std::shared_ptr<ov::util::MappedMemory> memory, size_t offset = 0)
+        : _memory(std::move(memory)),
+          _offset(offset) {}
+
+    void* lock(void* handle, LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return _offset <= _memory->size() && size <= _memory->size() - _offset ? _memory->data() + _offset : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> _memory;
+    size_t _offset;
+};
+
+}  // namespace InferenceEngine
@@ -5,10 +5,15 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <type_traits>
 
 #include "ie_parallel.hpp"
@@ -19,32 +24,216 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue.
+ * The ring of the cells, each cell has the sequence number which tells whether the cell is ready for the push or
+ * for the pop on the current lap, so the producers and the consumers synchronize on the cells, not on the shared lock.
+ * @tparam T The value type, must be default constructible and move assignable
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @param capacity The maximum number of the values, rounded up to the power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity = 1024) {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i)
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pushes the value if the queue is not full
+     * @return true if the value is pushed, the value is moved only in this case
+     */
+    bool try_push(T&& value) {
+        Cell* cell = nullptr;
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the value if the queue is not empty.
+     * The value claimed by a producer, but not yet written, is waited for, so the pop never misses the value
+     * which push is completed
+     * @return true if the value is popped
+     */
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                if (_enqueuePos.load(std::memory_order_relaxed) == pos)
+                    return false;
+                // the push is in flight
+                std::this_thread::yield();
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->value);
+        // releases the resources held by the value
+        cell->value = T();
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const {
+        return _mask + 1;
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+    // separates the frequently modified positions to the different cache lines
+    static constexpr std::size_t cacheLineSize = 64;
+
+    std::size_t _mask = 0;
+    std::unique_ptr<Cell[]> _cells;
+    char _padding0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos{0};
+    char _padding1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos{0};
+    char _padding2[cacheLineSize];
+};
+
+/**
+ * @brief Unbounded multi-producer multi-consumer queue with the size.
+ * The values go through the lock-free ring, the mutex protected overflow queue is used only when the ring is full.
+ * The order is FIFO: while the overflow queue is not empty the new values go to it as well, and the consumers pop it
+ * only when the ring is empty (the ring pop waits for the values claimed, but not yet written by the producers).
+ * So the values of each producer are popped in the order of their pushes, also across the overflow.
+ */
 template <typename T>
 class ThreadSafeQueueWithSize {
 public:
     void push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
+        // while the overflow queue is not empty the values go to it, so the overflow is drained in turn
+        if (_overflowSize.load() != 0 || !_ring.try_push(std::move(value))) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queue.push(std::move(value));
+            ++_overflowSize;
+        }
+        ++_size;
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
+        if (!_ring.try_pop(value)) {
+            if (_overflowSize.load() == 0)
+                return false;
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_queue.empty())
+                return false;
             value = std::move(_queue.front());
             _queue.pop();
-            return true;
-        } else {
-            return false;
+            --_overflowSize;
         }
+        --_size;
+        return true;
     }
+    // the number of the completely pushed values
     size_t size() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.size();
+        return static_cast<size_t>(std::max<std::int64_t>(_size.load(), 0));
     }
 
 protected:
+    LockFreeBoundedQueue<T> _ring;
+    std::atomic<std::int64_t> _size{0};
+    std::atomic<std::size_t> _overflowSize{0};
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+
+/**
+ * @brief Multi-producer multi-consumer queue with the blocking pop.
+ * The consumer spins for a while before it parks on the condition variable, so under the high load the values are
+ * passed without the sleep and wake-up latency, while the producer takes the lock only if there is a parked consumer.
+ */
+template <typename T>
+class ThreadSafeParkingQueue {
+public:
+    void push(T value) {
+        _queue.push(std::move(value));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_parked.load(std::memory_order_relaxed) != 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cv.notify_one();
+        }
+    }
+
+    /**
+     * @brief Pops the value, waits for it if the queue is empty
+     * @return false if the queue is stopped and empty
+     */
+    bool pop(T& value) {
+        for (int i = 0; i < spinCount && !_stopped.load(std::memory_order_relaxed); ++i) {
+            if (_queue.try_pop(value))
+                return true;
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_parked;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool popped = false;
+        _cv.wait(lock, [&] {
+            return (popped = _queue.try_pop(value)) || _stopped.load();
+        });
+        --_parked;
+        return popped;
+    }
+
+    /**
+     * @brief Wakes up all the consumers, the pop returns the remaining values and then fails
+     */
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _cv.notify_all();
+    }
+
+    size_t size() {
+        return _queue.size();
+    }
+
+protected:
+    static constexpr int spinCount = 100;
+
+    ThreadSafeQueueWithSize<T> _queue;
+    std::atomic<int> _parked{0};
+    std::atomic_bool _stopped{false};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+};
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
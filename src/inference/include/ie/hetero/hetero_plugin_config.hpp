@@ -34,5 +34,15 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipeline parallel execution of the subgraphs.
+ * Every subgraph is executed as a stage of the pipeline with its own pool of the device infer requests,
+ * so the subgraphs of the different HETERO infer requests run simultaneously on the different devices and
+ * the throughput approaches the one of the slowest subgraph. The networks with dynamic shapes are executed
+ * in the default mode.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_PARALLEL);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -438,6 +438,18 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property enables memory mapping of the model weights files instead of reading them into memory.
+ *
+ * Mapped weights are paged in lazily on the first access and the pages are shared between all processes
+ * which read the same model. The property is enabled by default and can be changed for the Core only:
+ *
+ * @code
+ * ie.set_property(ov::enable_mmap(false)); // weights files are read into allocated memory
+ * @endcode
+ */
+static constexpr Property<bool> enable_mmap{"ENABLE_MMAP"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  *
@@ -12,13 +12,23 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
@@ -41,6 +51,278 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+/// -------- Fast model hash -------------
+// Walks the model graph instead of the serialization to XML, the constants data is hashed by xxHash64,
+// so the hash costs about one pass over the weights memory
+
+/**
+ * @brief Memoizes the hashes of the constant buffers, so the same model (e.g. loaded to several devices or
+ * compiled several times) hashes its weights only once. The record is valid while the buffer is alive,
+ * the constant data is treated as immutable.
+ */
+class ConstantsHashCache {
+    // the buffers smaller than this are hashed faster than looked up
+    static constexpr size_t minSize = 4096;
+
+    struct Record {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::runtime::AlignedBuffer*, Record> m_records;
+    size_t m_cleanupSize = 1024;
+
+public:
+    uint64_t get(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        if (buffer->size() < minSize)
+            return ov::util::xxhash64(buffer->get_ptr(), buffer->size());
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_records.find(buffer.get());
+            if (it != m_records.end() && it->second.buffer.lock() == buffer)
+                return it->second.hash;
+        }
+
+        const auto hash = ov::util::xxhash64(buffer->get_ptr(), buffer->size());
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_records[buffer.get()] = {buffer, hash};
+        if (m_records.size() > m_cleanupSize) {
+            for (auto it = m_records.begin(); it != m_records.end();) {
+                it = it->second.buffer.expired() ? m_records.erase(it) : std::next(it);
+            }
+            m_cleanupSize = std::max(m_cleanupSize, 2 * m_records.size());
+        }
+        return hash;
+    }
+};
+
+ConstantsHashCache& constants_hash_cache() {
+    static ConstantsHashCache cache;
+    return cache;
+}
+
+// the attribute which can't be hashed without the serialization
+struct UnsupportedAttribute {};
+
+uint64_t hash_model(const std::shared_ptr<ov::Model>& model, uint64_t seed);
+
+uint64_t hash_rt_info(uint64_t seed, const ov::RTMap& rt) {
+    for (const auto& rtMapData : rt) {
+        seed = hash_combine(seed, rtMapData.first);
+        if (rtMapData.second.is<std::string>()) {
+            seed = hash_combine(seed, rtMapData.second.as<std::string>());
+        } else {
+            std::stringstream strm;
+            rtMapData.second.print(strm);
+            seed = hash_combine(seed, strm.str());
+        }
+    }
+    return seed;
+}
+
+uint64_t hash_shape(uint64_t seed, const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic())
+        return hash_combine(seed, -2);
+    seed = hash_combine(seed, shape.size());
+    for (const auto& dim : shape) {
+        seed = hash_combine(seed, dim.get_min_length());
+        seed = hash_combine(seed, dim.get_max_length());
+    }
+    return seed;
+}
+
+class HashVisitor : public ov::AttributeVisitor {
+    uint64_t& m_seed;
+
+    template <typename T>
+    void hash_value(const std::string& name, const T& value) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hash_vector(const std::string& name, const std::vector<T>& values) {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_combine(m_seed, values.size());
+        for (const auto& value : values)
+            m_seed = hash_combine(m_seed, value);
+    }
+
+public:
+    explicit HashVisitor(uint64_t& seed) : m_seed(seed) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+        using ov::op::util::MultiSubGraphOp;
+
+        m_seed = hash_combine(m_seed, name);
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto& buffer = a->get();
+            m_seed = hash_combine(m_seed, buffer->size());
+            m_seed = hash_combine(m_seed, constants_hash_cache().get(buffer));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_input_index);
+                m_seed = hash_combine(m_seed, desc->m_body_parameter_index);
+                if (auto slice = ov::as_type_ptr<MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    for (auto v : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto merged = ov::as_type_ptr<MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_seed = hash_combine(m_seed, std::string(desc->get_type_info().name));
+                m_seed = hash_combine(m_seed, desc->m_output_index);
+                m_seed = hash_combine(m_seed, desc->m_body_value_index);
+                if (auto concat = ov::as_type_ptr<MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (auto v : {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis})
+                        m_seed = hash_combine(m_seed, v);
+                } else if (auto body = ov::as_type_ptr<MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    m_seed = hash_combine(m_seed, body->m_iteration);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().current_iteration_input_idx);
+            m_seed = hash_combine(m_seed, a->get().body_condition_output_idx);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_seed = hash_combine(m_seed, info.variable_id);
+            m_seed = hash_combine(m_seed, as_int32_t(ov::element::Type_t(info.data_type)));
+            m_seed = hash_shape(m_seed, info.data_shape);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_seed = hash_combine(m_seed, attrs.get_type_name());
+            m_seed = hash_combine(m_seed, attrs.get_opset_name());
+            // the attributes are not ordered
+            uint64_t attrsHash = 0;
+            for (const auto& attr : attrs)
+                attrsHash += hash_combine(hash_combine(0, attr.first), attr.second);
+            m_seed = hash_combine(m_seed, attrsHash);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                m_seed = hash_combine(m_seed, as_int32_t(ov::element::Type_t(type)));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            m_seed = hash_shape(m_seed, a->get());
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            m_seed = hash_combine(m_seed, a->get().get_min_length());
+            m_seed = hash_combine(m_seed, a->get().get_max_length());
+        } else {
+            throw UnsupportedAttribute();
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        hash_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_seed = hash_combine(m_seed, name);
+        m_seed = hash_model(adapter.get(), m_seed);
+    }
+};
+
+uint64_t hash_model(const std::shared_ptr<ov::Model>& model, uint64_t seed) {
+    // auto-generated names are skipped, so the same model created twice has the same hash
+    auto hash_name = [&](const std::string& friendlyName, const std::string& name) {
+        if (friendlyName != name)
+            seed = hash_combine(seed, friendlyName);
+    };
+    hash_name(model->get_friendly_name(), model->get_name());
+
+    const auto ops = model->get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> ids;
+    for (size_t i = 0; i < ops.size(); i++)
+        ids[ops[i].get()] = i;
+    for (const auto& param : model->get_parameters())
+        seed = hash_combine(seed, ids.at(param.get()));
+    for (const auto& result : model->get_results())
+        seed = hash_combine(seed, ids.at(result.get()));
+    for (const auto& sink : model->get_sinks())
+        seed = hash_combine(seed, ids.at(sink.get()));
+
+    HashVisitor visitor(seed);
+    for (const auto& op : ops) {
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.get_version());
+        hash_name(op->get_friendly_name(), op->get_name());
+
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, ids.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+            seed = hash_rt_info(seed, input.get_rt_info());
+        }
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, as_int32_t(ov::element::Type_t(output.get_element_type())));
+            seed = hash_shape(seed, output.get_partial_shape());
+            const auto& names = output.get_names();
+            std::vector<std::string> sortedNames(names.begin(), names.end());
+            std::sort(sortedNames.begin(), sortedNames.end());
+            for (const auto& name : sortedNames)
+                seed = hash_combine(seed, name);
+            seed = hash_rt_info(seed, output.get_rt_info());
+        }
+
+        if (!op->visit_attributes(visitor))
+            throw UnsupportedAttribute();
+        seed = hash_rt_info(seed, op->get_rt_info());
+    }
+    return seed;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -74,26 +356,29 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(net.getFunction());
+    try {
+        // includes runtime information which may not be serialized
+        seed = hash_model(net.getFunction(), seed);
+    } catch (const UnsupportedAttribute&) {
+        // fallback to the hash of the serialized function
+        seed = 0;
+        ov::pass::Manager hashManager;
+        hashManager.register_pass<ov::pass::Hash>(seed);
+        hashManager.run_passes(net.getFunction());
+
+        // Add runtime information which may not be serialized
+        for (const auto& op : network.getFunction()->get_ordered_ops()) {
+            seed = hash_rt_info(seed, op->get_rt_info());
+        }
+    }
 
-    // 2. Compute hash on serialized data and options
+    // 2. Add options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
-        }
-    }
-
-    // 4. Add inputs info
+    // 3. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -114,7 +399,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 5. Add outputs info
+    // 4. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
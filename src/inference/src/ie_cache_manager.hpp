@@ -9,13 +9,23 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <string>
 
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
 #include "file_utils.h"
 #include "ie_api.h"
+#include "ie_shared_stream_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -76,6 +86,9 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * The entry is written to a temporary file which is renamed to the blob file when complete, so the processes sharing
+ * the cache directory never read a partially written blob. The blob is read through the memory mapping, so
+ * the reader stream is backed by a SharedStreamBuffer and a plugin can import the data without any copy.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
@@ -85,6 +98,17 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    // unique across the processes (by the process id) and the threads (by the counter) writing the same entry
+    static std::string getTempFile(const std::string& blobFileName) {
+        static std::atomic<uint64_t> counter{0};
+#ifdef _WIN32
+        const auto pid = _getpid();
+#else
+        const auto pid = getpid();
+#endif
+        return blobFileName + "." + std::to_string(pid) + "." + std::to_string(counter++) + ".tmp";
+    }
+
 public:
     /**
      * @brief Constructor
@@ -100,15 +124,49 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        auto blobFileName = getBlobFile(id);
+        auto tempFileName = getTempFile(blobFileName);
+        bool written = false;
+        try {
+            std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            stream.close();
+            written = !stream.fail();
+        } catch (...) {
+            std::remove(tempFileName.c_str());
+            throw;
+        }
+        // the entry which can't be written completely is not cached
+        if (!written) {
+            std::remove(tempFileName.c_str());
+            return;
+        }
+        // replaces the blob written concurrently by another process, which is the same network
+        if (std::rename(tempFileName.c_str(), blobFileName.c_str()) != 0) {
+            // e.g. the existing file can't be replaced on Windows
+            std::remove(blobFileName.c_str());
+            if (std::rename(tempFileName.c_str(), blobFileName.c_str()) != 0)
+                std::remove(tempFileName.c_str());
+        }
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            std::shared_ptr<ov::util::MappedMemory> memory;
+            try {
+                memory = ov::util::load_mmap_object(blobFileName);
+            } catch (const std::exception&) {
+                // fallback to the file stream, e.g. the file system doesn't support the mapping
+            }
+            if (memory) {
+                SharedStreamBuffer buffer(memory);
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -6,6 +6,7 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -160,6 +161,23 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
                 config.erase(it);
             }
+
+            it = config.find(ov::enable_mmap.name());
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES))
+                    _enableMmap = true;
+                else if (it->second == CONFIG_VALUE(NO))
+                    _enableMmap = false;
+                else
+                    IE_THROW() << "Wrong value for property key " << ov::enable_mmap.name()
+                               << ". Expected only YES/NO";
+
+                config.erase(it);
+            }
+        }
+
+        bool getEnableMmap() const {
+            return _enableMmap;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -171,6 +189,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _enableMmap{true};
     };
 
     // Core settings (cache config, etc)
@@ -480,7 +499,12 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        return InferenceEngine::details::ReadNetwork(modelPath,
+                                                     binPath,
+                                                     extensions,
+                                                     ov_extensions,
+                                                     newAPI,
+                                                     coreConfig.getEnableMmap());
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model,
@@ -23,6 +23,7 @@
 #    include "legacy/ie_ir_version.hpp"
 #endif
 #include "ie_itt.hpp"
+#include "ie_shared_stream_buffer.hpp"
 #include "legacy/ie_reader.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -31,6 +32,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_ptr.hpp"
 #include "transformations/rt_info/old_api_map_order_attribute.hpp"
@@ -211,7 +213,8 @@ void assertIfIRv7LikeModel(std::istream& modelStream) {
 
 CNNNetwork load_ir_v7_network(const std::string& modelPath,
                               const std::string& binPath,
-                              const std::vector<IExtensionPtr>& exts) {
+                              const std::vector<IExtensionPtr>& exts,
+                              bool enableMmap) {
     // Fix unicode name
 #    if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::wstring model_path = ov::util::string_to_wstring(modelPath.c_str());
@@ -254,22 +257,37 @@ CNNNetwork load_ir_v7_network(const std::string& modelPath,
 #    else
                 std::string weights_path = bPath;
 #    endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    IE_THROW() << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C});
+                Blob::Ptr weights;
+                if (enableMmap) {
+                    std::shared_ptr<ov::util::MappedMemory> mappedMemory;
+                    try {
+                        mappedMemory = ov::util::load_mmap_object(weights_path);
+                    } catch (const std::exception& ex) {
+                        IE_THROW() << "Weights file " << bPath << " cannot be mapped! " << ex.what();
+                    }
 
-                {
-                    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ReadNetworkWeights");
+                    const size_t fileSize = mappedMemory->size();
+                    weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C},
+                                                        std::make_shared<MappedMemoryAllocator>(mappedMemory));
                     weights->allocate();
-                    binStream.read(weights->buffer(), fileSize);
-                    binStream.close();
+                } else {
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        IE_THROW() << "Weights file " << bPath << " cannot be opened!";
+
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
+
+                    weights = make_shared_blob<uint8_t>({Precision::U8, {fileSize}, C});
+
+                    {
+                        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ReadNetworkWeights");
+                        weights->allocate();
+                        binStream.read(weights->buffer(), fileSize);
+                        binStream.close();
+                    }
                 }
 
                 // read model with weights
@@ -463,13 +481,14 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                bool enableMmap) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
         // Register readers if it is needed
         registerReaders();
-        auto cnnnetwork = load_ir_v7_network(modelPath, binPath, exts);
+        auto cnnnetwork = load_ir_v7_network(modelPath, binPath, exts, enableMmap);
 
         OPENVINO_SUPPRESS_DEPRECATED_START
         if (static_cast<ICNNNetwork::Ptr>(cnnnetwork) != nullptr) {
@@ -508,6 +527,9 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        // only IR frontend is able to map the weights file
+        if (enableMmap && FE->get_name() == "ir")
+            params.emplace_back(enableMmap);
         inputModel = FE->load(params);
     }
 
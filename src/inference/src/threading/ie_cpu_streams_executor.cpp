@@ -7,7 +7,6 @@
 #include <atomic>
 #include <cassert>
 #include <climits>
-#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -21,6 +20,7 @@
 #include "ie_system_conf.h"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
+#include "threading/ie_thread_safe_containers.hpp"
 
 using namespace openvino;
 
@@ -218,32 +218,18 @@ struct CPUStreamsExecutor::Impl {
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
+                for (Task task; _taskQueue.pop(task);) {
                     if (task) {
                         Execute(task, *(_streams.local()));
                     }
+                    task = nullptr;
                 }
             });
         }
     }
 
     void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
-        }
-        _queueCondVar.notify_one();
+        _taskQueue.push(std::move(task));
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,10 +266,8 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
-    std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    // lock-free task queue, the idle stream threads park on it after a short spin
+    ThreadSafeParkingQueue<Task> _taskQueue;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -309,11 +293,7 @@ int CPUStreamsExecutor::GetNumaNodeId() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
+    _impl->_taskQueue.stop();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
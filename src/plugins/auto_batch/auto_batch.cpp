@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -27,7 +28,9 @@
 namespace AutoBatchPlugin {
 using namespace InferenceEngine;
 
-std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), CONFIG_KEY(AUTO_BATCH_TIMEOUT)};
+std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+                                                 CONFIG_KEY(AUTO_BATCH_TIMEOUT),
+                                                 CONFIG_KEY_INTERNAL(AUTO_BATCH_PARTIAL_BATCH_NETWORKS)};
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -52,6 +55,20 @@ Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
     }
 }
 
+namespace {
+void UpdateArrivalInterval(AutoBatchExecutableNetwork::WorkerInferRequest& workerRequest) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    const int64_t last = workerRequest._lastArrival.exchange(now);
+    if (!last)
+        return;
+    // exponential moving average (with 1/4 weight for the new sample), races only make the estimate less accurate
+    const int64_t avg = workerRequest._arrivalInterval;
+    workerRequest._arrivalInterval = avg ? avg + (now - last - avg) / 4 : now - last;
+}
+}  // namespace
+
 // ------------------------------AutoBatchInferRequest----------------------------
 AutoBatchInferRequest::AutoBatchInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                              const std::vector<std::shared_ptr<const ov::Node>>& outputs,
@@ -333,13 +350,35 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToRequest(SoIInferRequestInternal& req, size_t slot, size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, slot, batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromRequest(SoIInferRequestInternal& req, size_t slot, size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, slot, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +386,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +404,11 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
     }
 }
 
@@ -384,10 +427,12 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            UpdateArrivalInterval(workerInferRequest);
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            // the first request re-starts the time-out, so the batch is collected relative to its arrival
+            if (sz == workerInferRequest._batchSize || sz == 1) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -411,6 +456,9 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_myBatchedRequestWrapper._inferRequestsPartial.at(_inferRequest->_partialBatchSize)
+            ->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -430,11 +478,13 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksWithPartialBatch)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
       _networkWithoutBatch{networkWithoutBatch},
+      _networksWithPartialBatch{networksWithPartialBatch},
       _config{config},
       _batchedInputs(batchedInputs),
       _batchedOutputs(batchedOutputs) {
@@ -460,6 +510,19 @@ unsigned int AutoBatchExecutableNetwork::ParseTimeoutValue(const std::string& s)
     return val;
 }
 
+int AutoBatchExecutableNetwork::GetAdaptiveTimeout(const WorkerInferRequest& workerRequest, int collected) const {
+    const int64_t timeOut = _timeOut;
+    const int64_t interval = workerRequest._arrivalInterval;
+    if (!collected || !interval)
+        return static_cast<int>(timeOut);
+    // the time (in us) expected to collect the rest of the batch, given the observed arrival rate
+    const int64_t expected = (workerRequest._batchSize - collected) * interval;
+    // if the batch is expected to be collected within the time-out, wait a bit longer than the estimate,
+    // otherwise waiting for the whole time-out is pointless, so just give a chance to the next request
+    const int64_t wait = expected <= timeOut * 1000 ? 2 * expected : interval;
+    return static_cast<int>(std::min(timeOut, std::max<int64_t>(1, (wait + 999) / 1000)));
+}
+
 std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
     return _networkWithoutBatch->GetContext();
 }
@@ -509,21 +572,21 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
-                IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
+                IE_ASSERT(workerRequestPtr->_completionTasks.size() <= (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
-                    workerRequestPtr->_completionTasks[c]();
+                for (auto& task : workerRequestPtr->_completionTasks) {
+                    task();
                 }
                 // reset the timeout
                 workerRequestPtr->_cond.notify_one();
             });
-
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            int timeOut = _timeOut;
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(timeOut));
                 }
                 if (_terminate) {
                     break;
@@ -533,6 +596,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     const int sz = workerRequestPtr->_tasks.size();
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                        workerRequestPtr->_completionTasks.resize(sz);
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
@@ -542,30 +606,74 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         }
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
+                        // timeout to collect the batch is over, have to execute the requests collected so far,
+                        // with the smallest batch that fits all of them (unless this more than doubles the work)
+                        auto partial = _networksWithPartialBatch.lower_bound(sz);
+                        bool bPartialBatch =
+                            sz > 1 && partial != _networksWithPartialBatch.end() && partial->first <= 2 * sz;
+                        if (bPartialBatch && !workerRequestPtr->_inferRequestsPartial.count(partial->first)) {
+                            // the requests for the smaller batches are created on the first use
+                            try {
+                                workerRequestPtr->_inferRequestsPartial[partial->first] = {
+                                    partial->second->CreateInferRequest(),
+                                    partial->second._so};
+                            } catch (...) {
+                                bPartialBatch = false;
+                            }
+                        }
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                        if (bPartialBatch) {
+                            // the network compiled with the smaller batch, the data is copied to/from its slots
+                            const int partialBatch = partial->first;
+                            auto& req = workerRequestPtr->_inferRequestsPartial[partialBatch];
+                            std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> tasks(sz);
+                            for (int n = 0; n < sz; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
+                                tasks[n].first->_inferRequest->CopyInputsToRequest(req, n, partialBatch);
+                                tasks[n].first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                                tasks[n].first->_inferRequest->_partialBatchSize = partialBatch;
+                            }
+                            std::promise<void> all_completed;
+                            auto all_completed_future = all_completed.get_future();
+                            req->SetCallback([&req, &tasks, &all_completed, partialBatch](std::exception_ptr p) {
+                                for (size_t n = 0; n < tasks.size(); n++) {
                                     if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                                        tasks[n].first->_inferRequest->_exceptionPtr = p;
+                                    else
+                                        tasks[n].first->_inferRequest->CopyOutputsFromRequest(req, n, partialBatch);
+                                    tasks[n].second();
+                                }
+                                all_completed.set_value();
+                            });
+                            req->StartAsync();
+                            all_completed_future.get();
+                        } else {
+                            // no suitable batch, have to execute the requests in the batch1 mode
+                            // popping all tasks collected by the moment of the time-out and execute each with batch1
+                            std::atomic<int> arrived = {0};
+                            std::promise<void> all_completed;
+                            auto all_completed_future = all_completed.get_future();
+                            for (int n = 0; n < sz; n++) {
+                                IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                                t.first->_inferRequestWithoutBatch->SetCallback(
+                                    [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                        if (p)
+                                            t.first->_inferRequest->_exceptionPtr = p;
+                                        t.second();
+                                        if (sz == ++arrived)
+                                            all_completed.set_value();
+                                    });
+                                t.first->_inferRequest->_wasBatchedRequestUsed =
+                                    AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                                t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+                                t.first->_inferRequestWithoutBatch->StartAsync();
+                            }
+                            all_completed_future.get();
                         }
-                        all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
+                    timeOut = GetAdaptiveTimeout(*workerRequestPtr, static_cast<int>(workerRequestPtr->_tasks.size()));
                 }
             }
         });
@@ -753,14 +861,14 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) ||
+                   name == CONFIG_KEY_INTERNAL(AUTO_BATCH_PARTIAL_BATCH_NETWORKS)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception& e) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
         }
     }
@@ -779,6 +887,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY_INTERNAL(AUTO_BATCH_PARTIAL_BATCH_NETWORKS)] = "0";  // no partial batches by default
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -948,27 +1057,50 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
             networkConfig.insert(c);
     }
 
+    auto loadNetworkWithBatch = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
+    // a few networks with the smaller (power-of-two) batch sizes, to execute the partially collected batch
+    // on the time-out (rather than falling back to the batch1 for every collected request), only on demand
+    // as every network costs the device memory
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> executableNetworksWithPartialBatch;
+    const auto partialBatchNetworks = fullConfig.find(CONFIG_KEY_INTERNAL(AUTO_BATCH_PARTIAL_BATCH_NETWORKS));
+    const size_t maxPartialBatchNetworks =
+        partialBatchNetworks != fullConfig.end() ? std::stoul(partialBatchNetworks->second) : 0;
+    if (executableNetworkWithBatch && maxPartialBatchNetworks) {
+        int batch = 1;
+        while (batch * 2 < metaDevice.batchForDevice)
+            batch *= 2;
+        for (; batch > 1 && executableNetworksWithPartialBatch.size() < maxPartialBatchNetworks; batch /= 2) {
+            try {
+                executableNetworksWithPartialBatch[batch] = loadNetworkWithBatch(batch);
+            } catch (...) {
+                break;
+            }
+        }
+    }
 
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        executableNetworksWithPartialBatch);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
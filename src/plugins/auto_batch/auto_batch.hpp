@@ -43,6 +43,12 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // requests for the networks compiled with smaller batch sizes (to execute partially collected batches),
+        // created on the first use
+        std::map<int, InferenceEngine::SoIInferRequestInternal> _inferRequestsPartial;
+        // arrival rate of the requests, used to adapt the time-out
+        std::atomic<int64_t> _lastArrival = {0};      // in us
+        std::atomic<int64_t> _arrivalInterval = {0};  // moving average, in us
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -51,7 +57,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& networksWithPartialBatch = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -69,10 +76,13 @@ public:
 
 protected:
     static unsigned int ParseTimeoutValue(const std::string&);
+    // time-out (in ms) to wait for the rest of the batch, given the number of already collected requests
+    int GetAdaptiveTimeout(const WorkerInferRequest& workerRequest, int collected) const;
     std::atomic_bool _terminate = {false};
     DeviceInformation _device;
     InferenceEngine::SoExecutableNetworkInternal _network;
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _networksWithPartialBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
@@ -109,16 +119,25 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // copies the data to/from the given slot of the request batched with (smaller) batchSize
+    void CopyInputsToRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
+    void CopyOutputsFromRequest(InferenceEngine::SoIInferRequestInternal& req, size_t slot, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    int _partialBatchSize = 0;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
@@ -16,6 +16,33 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    // every subgraph is the stage shared by all the requests, the stage continues the pipeline from the callback
+    for (std::size_t stageId = 0; stageId < _heteroInferRequest->_stages.size(); ++stageId) {
+        struct StageExecutor : ITaskExecutor {
+            StageExecutor(HeteroInferRequest& inferRequest, std::size_t stageId)
+                : _inferRequest(inferRequest),
+                  _stageId(stageId) {}
+            void run(Task task) override {
+                _inferRequest._stages[_stageId]->StartAsync(
+                    _inferRequest._stageBlobs[_stageId],
+                    [this, task](const SoIInferRequestInternal& request, std::exception_ptr exceptionPtr) {
+                        _inferRequest._lastStageRequests[_stageId] = request;
+                        _exceptionPtr = exceptionPtr;
+                        task();
+                    });
+            };
+            HeteroInferRequest& _inferRequest;
+            std::size_t _stageId;
+            std::exception_ptr _exceptionPtr;
+        };
+
+        auto stageExecutor = std::make_shared<StageExecutor>(*_heteroInferRequest, stageId);
+        _pipeline.emplace_back(stageExecutor, [stageExecutor] {
+            if (nullptr != stageExecutor->_exceptionPtr) {
+                std::rethrow_exception(stageExecutor->_exceptionPtr);
+            }
+        });
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
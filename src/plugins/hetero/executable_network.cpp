@@ -516,6 +516,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipelineStages();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -671,6 +672,32 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipelineStages();
+}
+
+void HeteroExecutableNetwork::InitPipelineStages() {
+    auto itPipeline = _config.find(HETERO_CONFIG_KEY(PIPELINE_PARALLEL));
+    if (itPipeline == _config.end() || itPipeline->second != YES) {
+        return;
+    }
+    // the intermediate blobs are allocated once per request, so the shapes should be known in advance
+    auto isStatic = [](const std::vector<std::shared_ptr<const ov::Node>>& nodes) {
+        return std::all_of(nodes.begin(), nodes.end(), [](const std::shared_ptr<const ov::Node>& node) {
+            return node->get_output_partial_shape(0).is_static();
+        });
+    };
+    for (auto&& desc : _networks) {
+        if (!isStatic(desc._network->getInputs()) || !isStatic(desc._network->getOutputs())) {
+            return;
+        }
+    }
+    int index = 0;
+    for (auto&& desc : _networks) {
+        auto poolSize = desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        _stages.push_back(std::make_shared<PipelineStage>(desc._network,
+                                                          poolSize,
+                                                          openvino::itt::handle("Infer" + std::to_string(index++))));
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -809,6 +836,9 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     const auto& core = _plugin->GetCore();
     if (!core || !core->isNewAPI())
         return nullptr;
+    if (!_stages.empty()) {
+        return std::make_shared<HeteroInferRequest>(inputs, outputs, _stages, _blobNameMap);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -822,6 +852,9 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                            OutputsDataMap networkOutputs) {
+    if (!_stages.empty()) {
+        return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, _stages, _blobNameMap);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -849,7 +882,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
-    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
+    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINE_PARALLEL) ||
+               name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
@@ -933,6 +967,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE_PARALLEL),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -955,6 +990,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
         unsigned int value = 0u;
+        if (!_stages.empty()) {
+            // enough requests to keep every stage of the pipeline busy
+            for (auto&& stage : _stages) {
+                value += static_cast<unsigned int>(stage->GetPoolSize());
+            }
+            return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
+        }
         for (auto&& desc : _networks) {
             value = std::max(value,
                              desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
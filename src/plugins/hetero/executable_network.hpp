@@ -65,6 +65,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipelineStages();
 
     struct NetworkDesc {
         std::string _device;
@@ -77,6 +78,8 @@ private:
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    // not empty if the subnetworks are executed as the pipeline stages
+    std::vector<PipelineStage::Ptr> _stages;
 };
 
 }  // namespace HeteroPlugin
@@ -7,6 +7,7 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <blob_factory.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
@@ -39,6 +40,26 @@ HeteroInferRequest::HeteroInferRequest(
     CreateInferRequest(subgraphInputToOutputBlobNames);
 }
 
+HeteroInferRequest::HeteroInferRequest(
+    const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+    const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+    const std::vector<PipelineStage::Ptr>& stages,
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames)
+    : IInferRequestInternal(inputs, outputs),
+      _stages(stages) {
+    CreatePipelineBlobs(subgraphInputToOutputBlobNames);
+}
+
+HeteroInferRequest::HeteroInferRequest(
+    InferenceEngine::InputsDataMap networkInputs,
+    InferenceEngine::OutputsDataMap networkOutputs,
+    const std::vector<PipelineStage::Ptr>& stages,
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames)
+    : IInferRequestInternal(networkInputs, networkOutputs),
+      _stages(stages) {
+    CreatePipelineBlobs(subgraphInputToOutputBlobNames);
+}
+
 void HeteroInferRequest::CreateInferRequest(
     const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
@@ -85,7 +106,67 @@ void HeteroInferRequest::CreateInferRequest(
     }
 }
 
+void HeteroInferRequest::CreatePipelineBlobs(
+    const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        IE_THROW() << "Internal error: no information about network's output/input";
+    }
+
+    auto allocateBlob = [](const TensorDesc& desc) {
+        auto blob = make_blob_with_precision(desc);
+        blob->allocate();
+        return blob;
+    };
+    auto intermediateName = [&](const std::string& blobName) {
+        auto itName = subgraphInputToOutputBlobNames.find(blobName);
+        return itName != subgraphInputToOutputBlobNames.end() ? itName->second : blobName;
+    };
+
+    _stageBlobs.resize(_stages.size());
+    _lastStageRequests.resize(_stages.size());
+    // the output blob of the producer stage is the input one of the consumer stage, so no copies are needed
+    for (size_t i = 0; i < _stages.size(); ++i) {
+        for (auto&& outputInfo : _stages[i]->GetNetwork()->GetOutputsInfo()) {
+            const auto& blobName = outputInfo.first;
+            auto blob = allocateBlob(outputInfo.second->getTensorDesc());
+            _stageBlobs[i].emplace(blobName, blob);
+            if (InferenceEngine::details::contains(_networkOutputs, blobName)) {
+                _stageFromBlobName.emplace(blobName, i);
+            } else {
+                _blobs.emplace(intermediateName(blobName), blob);
+            }
+        }
+    }
+    for (size_t i = 0; i < _stages.size(); ++i) {
+        for (auto&& inputInfo : _stages[i]->GetNetwork()->GetInputsInfo()) {
+            const auto& blobName = inputInfo.first;
+            if (InferenceEngine::details::contains(_networkInputs, blobName)) {
+                _stageBlobs[i].emplace(blobName, allocateBlob(inputInfo.second->getTensorDesc()));
+                _stageFromBlobName.emplace(blobName, i);
+            } else {
+                _stageBlobs[i].emplace(blobName, _blobs.at(intermediateName(blobName)));
+            }
+        }
+    }
+}
+
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (!_stages.empty()) {
+        auto itStage = _stageFromBlobName.find(name);
+        if (itStage == _stageFromBlobName.end()) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        if (!blob) {
+            IE_THROW(NotAllocated) << "Failed to set empty blob with name: " << name;
+        }
+        auto& stageBlob = _stageBlobs[itStage->second].at(name);
+        if (blob->size() != stageBlob->size()) {
+            IE_THROW() << "The size of the blob with name: " << name << " (" << blob->size()
+                       << ") doesn't match the expected one (" << stageBlob->size() << ")";
+        }
+        stageBlob = blob;
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +175,13 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (!_stages.empty()) {
+        auto itStage = _stageFromBlobName.find(name);
+        if (itStage == _stageFromBlobName.end()) {
+            IE_THROW() << "There is no infer requests binded to blob with name: " << name;
+        }
+        return _stageBlobs[itStage->second].at(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -102,6 +190,9 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (!_stages.empty()) {
+        IE_THROW(NotImplemented) << "Preprocessing is not supported by HETERO in the pipeline parallel mode";
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -110,6 +201,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (!_stages.empty()) {
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -118,6 +212,9 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    for (size_t i = 0; i < _stages.size(); ++i) {
+        _lastStageRequests[i] = _stages[i]->Infer(_stageBlobs[i]);
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -128,6 +225,16 @@ void HeteroInferRequest::InferImpl() {
 
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
+    // in the pipeline mode the counters are taken from the device requests which executed the last inference
+    for (size_t i = 0; i < _lastStageRequests.size(); i++) {
+        if (!_lastStageRequests[i]) {
+            continue;
+        }
+        auto perfMapRequest = _lastStageRequests[i]->GetPerformanceCounts();
+        for (auto&& r : perfMapRequest) {
+            perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
+        }
+    }
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
         for (auto&& r : perfMapRequest) {
@@ -15,6 +15,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "pipeline_stage.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -38,6 +40,21 @@ public:
                        const SubRequestsList& inferRequests,
                        const std::unordered_map<std::string, std::string>& blobNameMap);
 
+    /**
+     * @brief Creates the request executed by the pipeline stages. The request does not own the device requests,
+     * it owns the blobs of the network inputs, outputs and the intermediate ones which are bound to the requests of
+     * the stages for every inference.
+     */
+    HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                       InferenceEngine::OutputsDataMap networkOutputs,
+                       const std::vector<PipelineStage::Ptr>& stages,
+                       const std::unordered_map<std::string, std::string>& blobNameMap);
+
+    HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
+                       const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
+                       const std::vector<PipelineStage::Ptr>& stages,
+                       const std::unordered_map<std::string, std::string>& blobNameMap);
+
     void InferImpl() override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) override;
@@ -56,8 +73,15 @@ public:
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::IInferRequestInternal*> _subRequestFromBlobName;
 
+    // pipeline mode
+    std::vector<PipelineStage::Ptr> _stages;
+    std::vector<InferenceEngine::BlobMap> _stageBlobs;
+    std::vector<InferenceEngine::SoIInferRequestInternal> _lastStageRequests;
+    std::map<std::string, size_t> _stageFromBlobName;
+
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void CreatePipelineBlobs(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "itt.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+PipelineStage::PipelineStage(const SoExecutableNetworkInternal& network,
+                             size_t poolSize,
+                             openvino::itt::handle_t profilingTask)
+    : _network(network),
+      _profilingTask(profilingTask) {
+    poolSize = std::max<size_t>(poolSize, 1);
+    for (size_t i = 0; i < poolSize; ++i) {
+        SoIInferRequestInternal request = {_network->CreateInferRequest(), _network._so};
+        request->setModelInputsOutputs(_network->getInputs(), _network->getOutputs());
+        _requests.emplace_back(std::move(request));
+        _idleRequests.push_back(i);
+    }
+}
+
+void PipelineStage::StartAsync(const BlobMap& blobs, Callback callback) {
+    size_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_idleRequests.empty()) {
+            _jobs.push_back({blobs, std::move(callback)});
+            return;
+        }
+        requestId = _idleRequests.back();
+        _idleRequests.pop_back();
+    }
+    Run(requestId, {blobs, std::move(callback)});
+}
+
+SoIInferRequestInternal PipelineStage::Infer(const BlobMap& blobs) {
+    size_t requestId = 0;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _idleRequestAvailable.wait(lock, [this] {
+            return !_idleRequests.empty();
+        });
+        requestId = _idleRequests.back();
+        _idleRequests.pop_back();
+    }
+    auto& request = _requests[requestId];
+    try {
+        for (auto&& blob : blobs) {
+            request->SetBlob(blob.first, blob.second);
+        }
+        OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, _profilingTask);
+        request->Infer();
+    } catch (...) {
+        Release(requestId);
+        throw;
+    }
+    Release(requestId);
+    return request;
+}
+
+void PipelineStage::Run(size_t requestId, Job job) {
+    auto& request = _requests[requestId];
+    auto callback = std::move(job._callback);
+    try {
+        for (auto&& blob : job._blobs) {
+            request->SetBlob(blob.first, blob.second);
+        }
+        // The callback is set for every job rather than once: the request may be restarted from its own
+        // completion callback, and only the callback set just before StartAsync is guaranteed to be called.
+        request->SetCallback([this, requestId, callback](std::exception_ptr exceptionPtr) {
+            auto request = _requests[requestId];
+            Release(requestId);
+            callback(request, exceptionPtr);
+        });
+        request->StartAsync();
+    } catch (...) {
+        Release(requestId);
+        callback(request, std::current_exception());
+    }
+}
+
+void PipelineStage::Release(size_t requestId) {
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_jobs.empty()) {
+            _idleRequests.push_back(requestId);
+            _idleRequestAvailable.notify_one();
+            return;
+        }
+        job = std::move(_jobs.front());
+        _jobs.pop_front();
+    }
+    Run(requestId, std::move(job));
+}
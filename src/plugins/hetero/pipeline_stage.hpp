@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+
+#include <condition_variable>
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <openvino/itt.hpp>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief A subgraph of the HETERO network executed as a stage of the pipeline.
+ * The stage owns the pool of the device infer requests, so several HETERO infer requests are executed by the stage
+ * simultaneously. The jobs which do not find an idle request are queued in the FIFO order. As every HETERO infer
+ * request has at most one job in flight per stage, the queue length is bounded by the number of HETERO requests.
+ * The blobs of a job are bound to the device request with SetBlob, so the intermediate blobs are shared between the
+ * neighbouring stages without copies.
+ */
+class PipelineStage {
+public:
+    using Ptr = std::shared_ptr<PipelineStage>;
+    using Callback = std::function<void(const InferenceEngine::SoIInferRequestInternal&, std::exception_ptr)>;
+
+    PipelineStage(const InferenceEngine::SoExecutableNetworkInternal& network,
+                  size_t poolSize,
+                  openvino::itt::handle_t profilingTask);
+
+    /**
+     * @brief Runs the stage for the blobs asynchronously
+     * @param callback is called from the device callback executor once the job is done
+     */
+    void StartAsync(const InferenceEngine::BlobMap& blobs, Callback callback);
+
+    /**
+     * @brief Runs the stage for the blobs in the calling thread
+     * @return the device request which executed the job
+     */
+    InferenceEngine::SoIInferRequestInternal Infer(const InferenceEngine::BlobMap& blobs);
+
+    size_t GetPoolSize() const {
+        return _requests.size();
+    }
+
+    const InferenceEngine::SoExecutableNetworkInternal& GetNetwork() const {
+        return _network;
+    }
+
+private:
+    struct Job {
+        InferenceEngine::BlobMap _blobs;
+        Callback _callback;
+    };
+
+    void Run(size_t requestId, Job job);
+    void Release(size_t requestId);
+
+    InferenceEngine::SoExecutableNetworkInternal _network;
+    openvino::itt::handle_t _profilingTask;
+    std::vector<InferenceEngine::SoIInferRequestInternal> _requests;
+
+    std::mutex _mutex;
+    std::condition_variable _idleRequestAvailable;
+    std::vector<size_t> _idleRequests;
+    std::deque<Job> _jobs;
+};
+
+}  // namespace HeteroPlugin
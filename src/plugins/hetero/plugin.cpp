@@ -27,6 +27,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE_PARALLEL)] = NO;
 }
 
 namespace {
@@ -40,6 +41,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINE_PARALLEL),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -214,11 +216,11 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINE_PARALLEL)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
-        bool dump = it->second == YES;
-        return {dump};
+        bool enabled = it->second == YES;
+        return {enabled};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
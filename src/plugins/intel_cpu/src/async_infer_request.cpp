@@ -9,7 +9,19 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInfe
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    auto syncRequest = static_cast<InferRequestBase*>(inferRequest.get());
+    syncRequest->SetAsyncRequest(this);
+
+    if (const auto traceBuffer = syncRequest->GetPipelineTraceBuffer()) {
+        const auto stageName = syncRequest->GetPipelineStageTraceName();
+        for (auto& stage : _pipeline) {
+            const auto task = stage.second;
+            stage.second = [traceBuffer, stageName, task] {
+                TraceScope traceScope(traceBuffer.get(), TraceCategory::PipelineStage, stageName);
+                task();
+            };
+        }
+    }
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 #include "lru_cache.h"
 
 namespace ov {
@@ -17,18 +23,30 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
 public:
     virtual ~CacheEntryBase() = default;
+    virtual Statistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&)
+ *         and size_t size() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The implementation is thread safe. The records are distributed (by the key hash) among the shards, each with
+ *       its own lock and storage (of the capacity / shards records), so the concurrent look ups of different keys rarely
+ *       contend. The value for a key is built only once: the concurrent requests of the key being built wait for the
+ *       builder result, without blocking the shard.
  */
 
 template<typename KeyType,
@@ -39,7 +57,16 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    /**
+     * @param capacity is the maximum number of records
+     * @param shards is the number of shards, the single shard keeps the exact eviction policy of the ImplType
+     */
+    explicit CacheEntry(size_t capacity, size_t shards = 1) : _capacity(capacity) {
+        shards = std::max<size_t>(1, std::min(shards, capacity));
+        const size_t shardCapacity = (capacity + shards - 1) / shards;
+        for (size_t i = 0; i < shards; i++)
+            _shards.emplace_back(new Shard(shardCapacity));
+    }
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -50,24 +77,89 @@ public:
      */
 
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
-        if (0 == _impl.getCapacity()) {
+        if (0 == _capacity) {
             // fast track
+            _misses++;
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
-        auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
-        auto retEmpty = ValType();
-        if (retVal == retEmpty) {
-            retStatus = LookUpStatus::Miss;
+        auto& shard = *_shards[key.hash() % _shards.size()];
+        const auto retEmpty = ValType();
+        std::promise<ValType> promise;
+        std::shared_future<ValType> building;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            ValType retVal = shard.impl.get(key);
+            if (retVal != retEmpty) {
+                _hits++;
+                return {retVal, LookUpStatus::Hit};
+            }
+            auto itr = shard.building.find(key);
+            if (itr != shard.building.end()) {
+                building = itr->second;
+            } else {
+                shard.building.emplace(key, promise.get_future().share());
+            }
+        }
+
+        if (building.valid()) {
+            // the value is being built by another thread
+            _hits++;
+            return {building.get(), LookUpStatus::Hit};
+        }
+
+        _misses++;
+        ValType retVal;
+        try {
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.building.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
         }
-        return {retVal, retStatus};
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (retVal != retEmpty) {
+                const auto size = shard.impl.size();
+                shard.impl.put(key, retVal);
+                if (shard.impl.size() == size)
+                    _evictions++;
+            }
+            shard.building.erase(key);
+        }
+        promise.set_value(retVal);
+        return {retVal, LookUpStatus::Miss};
     }
 
-public:
-    ImplType _impl;
+    Statistics getStatistics() const override {
+        Statistics statistics;
+        statistics.hits = _hits;
+        statistics.misses = _misses;
+        statistics.evictions = _evictions;
+        return statistics;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const KeyType &k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : impl(capacity) {}
+        std::mutex mutex;
+        ImplType impl;
+        std::unordered_map<KeyType, std::shared_future<ValType>, key_hasher> building;
+    };
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    std::atomic_size_t _evictions{0};
 };
 
 }   // namespace intel_cpu
@@ -77,6 +77,14 @@ public:
         }
     }
 
+    /**
+     * @brief Returns the number of records in the cache
+     * @return the number of records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
     /**
      * @brief Returns the current capacity value
      * @return the current capacity value
@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +16,9 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The implementation is thread safe, so a single instance may be shared between the graphs of different streams.
+ *       But the cached values are not necessarily: e.g. the executors keep the mutable state, so only the stateless
+ *       values are put to the shared instance, see Node::getSharedRuntimeCache.
  */
 
 class MultiCache {
@@ -29,9 +32,15 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param shards is the number of independently locked shards of each entry
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, size_t shards = 1) : _capacity(capacity), _shards(shards) {}
+
+    MultiCache(const MultiCache& rhs) : _capacity(rhs._capacity), _shards(rhs._shards) {
+        std::lock_guard<std::mutex> lock(rhs._mutex);
+        _storage = rhs._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -49,6 +58,21 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the look up statistics accumulated over all the entries
+    */
+    CacheEntryBase::Statistics getStatistics() const {
+        CacheEntryBase::Statistics statistics;
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& item : _storage) {
+            const auto entryStatistics = item.second->getStatistics();
+            statistics.hits += entryStatistics.hits;
+            statistics.misses += entryStatistics.misses;
+            statistics.evictions += entryStatistics.evictions;
+        }
+        return statistics;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +82,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _shards;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -71,9 +97,10 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _shards)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
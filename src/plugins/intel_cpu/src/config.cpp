@@ -148,6 +148,45 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_ZERO_COPY_STATES == key) {
+            if (val == PluginConfigParams::YES) zeroCopyStates = true;
+            else if (val == PluginConfigParams::NO) zeroCopyStates = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ZERO_COPY_STATES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION == key) {
+            if (val == PluginConfigParams::YES) parallelGraphExecution = true;
+            else if (val == PluginConfigParams::NO) parallelGraphExecution = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_REUSE == key) {
+            if (val == PluginConfigParams::YES) dynamicMemoryReuse = true;
+            else if (val == PluginConfigParams::NO) dynamicMemoryReuse = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_REUSE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE == key) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Expected only float numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE
+                           << ". Sparse rate must be in range [0.0f,1.0f]";
+            }
+            fcSparseWeiDecompressionRate = val_f;
+        } else if (PluginConfigInternalParams::KEY_CPU_FC_WEIGHTS_DECOMPRESSION == key) {
+            if (val == PluginConfigParams::YES) fcWeightsDecompression = true;
+            else if (val == PluginConfigParams::NO) fcWeightsDecompression = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_FC_WEIGHTS_DECOMPRESSION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_EXECUTION_TRACE == key) {
+            executionTracePath = val;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
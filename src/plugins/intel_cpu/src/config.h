@@ -28,6 +28,13 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    bool zeroCopyStates = false;
+    bool parallelGraphExecution = false;
+    bool dynamicMemoryReuse = false;
+    float fcSparseWeiDecompressionRate = 1.0f;
+    bool fcWeightsDecompression = false;
+    // the file of the execution timeline, the tracing is disabled if empty, see ExecutionTrace
+    std::string executionTracePath = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
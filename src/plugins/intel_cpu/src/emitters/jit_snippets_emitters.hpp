@@ -21,9 +21,17 @@ namespace intel_cpu {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // The schedule is passed in runtime only to the kernels compiled for dynamic shapes,
+    // the fields have the same meaning as the ones of jit_snippets_compile_args
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
+    // The kernel reads the scheduler dims and the offsets from jit_snippets_call_args, so it can be reused
+    // for any shapes with the same broadcasting over the innermost dimension
+    bool is_dynamic = false;
     int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
@@ -35,6 +43,7 @@ struct jit_snippets_compile_args {
 /// be organized in the following way:
 /// KernelEmitter {          /* entry point */
 ///     TileEmitter {        /* outer tile */
+///         ...              /* A pass per reduction if the body has reductions, see the reduction emitters below */
 ///         TileEmitter {    /* inner vector tile */
 ///             ...          /* All the necessary Load/Strore/elementwise emitters */
 ///         }
@@ -43,6 +52,8 @@ struct jit_snippets_compile_args {
 ///         }
 ///     }
 /// }
+/// If the kernel is compiled for dynamic shapes (see jit_snippets_compile_args::is_dynamic), the Kernel and the Tiles
+/// read the data offsets and the work amounts from jit_snippets_call_args instead of the immediate values.
 /// Note that Kernel params are passed directly to the emit_code(). The vector of inputs should contain 2 arguments, the
 /// output vector should be empty. Input parameters
 ///
@@ -120,13 +131,24 @@ private:
                 }
             }
         };
+        // the offsets are unknown in compile time, so they are taken from the call args for all the harness dims
+        auto init_ptrs_with_runtime_offsets = [&](Reg64 pointer, size_t offsets_idx) {
+            for (int j = 0; j < harness_num_dims; j++) {
+                h->mov(reg_tmp_64, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+                h->imul(reg_tmp_64, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp_64);
+            }
+        };
         for (auto i = 0; i < num_params; i++) {
             regs[i] = Reg64(reg64_tmp_start + i);
             if (i < num_inputs)
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
             else
                 h->mov(regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-            init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
+            if (jcp.is_dynamic)
+                init_ptrs_with_runtime_offsets(regs[i], i * harness_num_dims);
+            else
+                init_ptrs_with_offsets(regs[i], &jcp.data_offsets[i * harness_num_dims]);
         }
 
         for (auto& c : code) {
@@ -205,6 +227,7 @@ private:
         const size_t dim = in[3]; // tile dimension: 0 - outer, 1 - inner
         const int reg64_tmp_start { 8 }; // R8, R9, R10, R11, R12, R13, R14, R15 inputs+outputs+1
         Reg64 amount = Reg64(reg64_tmp_start + num_params); // amount
+        Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
         std::array<Label, 2> for_body;
 
         // If R15 is not used, reserve it for use in scalar to avoid redundant push-pop's.
@@ -214,15 +237,20 @@ private:
         for (auto i = 0; dim == 0 && i < num_params; i++)
             regs[i] = Reg64(reg64_tmp_start + i);
         // Loop processing could be simplified in some cases
-        if (inc > jcp.scheduler_dims[dim]) {
+        if (!jcp.is_dynamic && inc > jcp.scheduler_dims[dim]) {
             return;
-        } else if (inc == jcp.scheduler_dims[dim]) {
+        } else if (!jcp.is_dynamic && inc == jcp.scheduler_dims[dim]) {
             for (auto& c : code) {
                 c.first->emit_code(c.second.first, c.second.second, pool, local_gpr);
             }
         } else {
+            // The work amount is known only in runtime, so the first tile in the dim reads it from the call args,
+            // and the next one processes the rest left by the previous tile
+            if (jcp.is_dynamic) {
+                if (previous_inc == 0)
+                    h->mov(amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + dim * sizeof(int64_t)]);
             // The previous tile has done nothing, all the work is ours
-            if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
+            } else if (previous_inc == 0 || previous_inc > jcp.scheduler_dims[dim]) {
                 h->mov(amount, jcp.scheduler_dims[dim]);
             // The previous tile has done all the work
             } else if (jcp.scheduler_dims[dim] % previous_inc == 0) {
@@ -242,13 +270,15 @@ private:
                 //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
                 //   To overcome this limitation, we add appropriate negative offsets if necessary.
                 for (auto i = 0; dim == 0 && i < num_params; i++) {
-                    if (jcp.scheduler_offsets[i] != 0) {
+                    if (jcp.is_dynamic) {
+                        h->add(regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+                    } else if (jcp.scheduler_offsets[i] != 0) {
                         h->add(regs[i], jcp.scheduler_offsets[i]);
                     }
                 }
-                    h->sub(amount, inc);
-                    h->cmp(amount, inc);
-                    h->jge(for_body[1], CodeGenerator::T_NEAR);
+                h->sub(amount, inc);
+                h->cmp(amount, inc);
+                h->jge(for_body[1], CodeGenerator::T_NEAR);
             }
 
             h->L(for_body[0]);
@@ -404,6 +434,174 @@ private:
     int32_t value;
 };
 
+///
+/// Reduction emitters:
+///
+/// Reductions are computed in a separate pass over the row each (see ngraph::snippets::Generator):
+/// the accumulator is initialized by ScalarEmitter with the identity value, ReduceEmitter accumulates the vector tile lanes,
+/// HorizonReduceEmitter reduces the lanes to the first one before the scalar tile accumulates the tail to this lane,
+/// then FakeBroadcastEmitter broadcasts the result and RewindPointersEmitter moves the data pointers back to the row beginning.
+///
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto reduce = ov::as_type_ptr<ngraph::snippets::op::Reduce>(n);
+        if (!reduce)
+            IE_THROW() << "ReduceEmitter invoked with invalid op argument";
+        kind = reduce->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                    Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+        Vmm vmm_src = Vmm(in[0]);
+        Vmm vmm_acc = Vmm(out[0]);
+
+        if (kind == ngraph::snippets::op::Reduce::Kind::Sum) {
+            h->uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+        } else {
+            h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src);
+        }
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class HorizonReduceEmitter : public jit_emitter {
+public:
+    HorizonReduceEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto horizon = ov::as_type_ptr<ngraph::snippets::op::HorizonReduce>(n);
+        if (!horizon)
+            IE_THROW() << "HorizonReduceEmitter invoked with invalid op argument";
+        kind = horizon->get_kind();
+    }
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override {
+        if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+            emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+            emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+        } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_common) {
+            emit_isa<dnnl::impl::cpu::x64::avx512_common>(in, out);
+        } else {
+            IE_THROW() << host_isa_;
+            assert(!"unsupported isa");
+        }
+    }
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+        auto reduce = [&](const Xmm& acc, const Xmm& src) {
+            if (kind == ngraph::snippets::op::Reduce::Kind::Sum) {
+                h->uni_vaddps(acc, acc, src);
+            } else {
+                h->uni_vmaxps(acc, acc, src);
+            }
+        };
+        if (in[0] != out[0])
+            IE_THROW() << "HorizonReduceEmitter expects the accumulator to be reduced in place";
+        const size_t acc_idx = out[0];
+        const size_t aux_idx = aux_vec_idxs[0];
+
+        if (isa == dnnl::impl::cpu::x64::avx512_common) {
+            h->vextractf64x4(Ymm(aux_idx), Zmm(acc_idx), 1);
+            reduce(Ymm(acc_idx), Ymm(aux_idx));
+        }
+        if (isa != dnnl::impl::cpu::x64::sse41) {
+            h->vextractf128(Xmm(aux_idx), Ymm(acc_idx), 1);
+            reduce(Xmm(acc_idx), Xmm(aux_idx));
+        }
+        Xmm xmm_acc = Xmm(acc_idx);
+        Xmm xmm_aux = Xmm(aux_idx);
+        h->uni_vmovshdup(xmm_aux, xmm_acc);           // acc: 0,1,2,3; aux: 1,1,3,3
+        reduce(xmm_acc, xmm_aux);                     // acc: 0+1,1+1,2+3,3+3
+        h->uni_vmovhlps(xmm_aux, xmm_aux, xmm_acc);   // aux: 2+3,3+3,3,3
+        reduce(xmm_acc, xmm_aux);                     // acc: 0+1+2+3,...
+    }
+
+private:
+    ngraph::snippets::op::Reduce::Kind kind;
+};
+
+class RewindPointersEmitter : public jit_emitter {
+public:
+    RewindPointersEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
+    : jit_emitter(h, isa, n) {
+        const auto rewind = ov::as_type_ptr<ngraph::snippets::op::RewindPointers>(n);
+        if (!rewind)
+            IE_THROW() << "RewindPointersEmitter invoked with invalid op argument";
+        if (!rewind->compile_params)
+            IE_THROW() << "RewindPointersEmitter invoked without compile_params";
+        effective_addresses = rewind->effective_addresses;
+        jcp = *reinterpret_cast<const jit_snippets_compile_args*>(rewind->compile_params);
+    }
+
+    size_t get_inputs_num() const override {return 0;}
+
+protected:
+    size_t aux_gprs_count() const override {return jcp.is_dynamic ? 1 : 0;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override {
+        // f32 is the only precision supported by snippets
+        if (jcp.is_dynamic) {
+            Reg64 reg_const_params { dnnl::impl::cpu::x64::abi_param2 };
+            Reg64 row_size = Reg64(static_cast<int>(aux_gpr_idxs[0]));
+            h->mov(row_size, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + (SNIPPETS_MAX_TILE_RANK - 1) * sizeof(int64_t)]);
+            h->imul(row_size, row_size, sizeof(float));
+            for (auto ea : effective_addresses) {
+                h->sub(Reg64(static_cast<int>(ea)), row_size);
+            }
+            return;
+        }
+        const int64_t row_size = jcp.scheduler_dims[SNIPPETS_MAX_TILE_RANK - 1] * sizeof(float);
+        for (auto ea : effective_addresses) {
+            h->sub(Reg64(static_cast<int>(ea)), row_size);
+        }
+    }
+
+    jit_snippets_compile_args jcp;
+    std::vector<size_t> effective_addresses;
+};
+
 ///
 /// Memory emitters:
 ///
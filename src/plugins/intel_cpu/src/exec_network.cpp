@@ -24,6 +24,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -56,6 +57,9 @@ ExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs
     return std::make_shared<LegacyInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<ExecNetwork>(shared_from_this()));
 }
 
+// the lock striping of the shared runtime cache, so the streams rarely contend on the look ups
+static constexpr size_t sharedRuntimeCacheShards = 16;
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -68,13 +72,15 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
                          NumaNodesWeights &numaNodesWeights,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const std::shared_ptr<const PrecomputedConstants>& precomputedConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-    _network(network) {
+    _network(network),
+    _precomputedConstants(precomputedConstants) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -123,6 +129,16 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    if (streams > 1) {
+        _sharedRtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, sharedRuntimeCacheShards);
+    }
+    if (!_cfg.executionTracePath.empty()) {
+        _executionTrace = std::make_shared<ExecutionTrace>(_cfg.executionTracePath);
+        _pipelineTraceBuffer = _executionTrace->createBuffer("Async pipeline");
+        _pipelineStageTraceName = _executionTrace->registerName("Pipeline stage");
+        if (_sharedRtParamsCache)
+            _executionTrace->addCacheStatistics("Shared runtime cache", _sharedRtParamsCache);
+    }
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
@@ -135,6 +151,8 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    // the graphs of all the streams are built, so the precomputed data (as large as the weights) is released
+    _precomputedConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -177,6 +195,9 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.SetPrecomputedConstants(_precomputedConstants);
+                graphLock._graph.SetSharedRuntimeCache(_sharedRtParamsCache);
+                graphLock._graph.SetExecutionTrace(_executionTrace, streamId);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -275,6 +296,12 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_DYNAMIC_MEMORY_PEAK) {
+        // the graphs of the streams are inferred concurrently, so their peaks are summed up
+        uint64_t peak = 0;
+        for (const auto& streamGraph : _graphs)
+            peak += streamGraph.GetDynamicMemoryPeak();
+        return peak;
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -541,6 +568,8 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+    // the graphs of all the streams are the same, so the constants of any of them can be stored
+    serializer << GetGraph()._graph.GetPrecomputedConstants();
 }
 
 }   // namespace intel_cpu
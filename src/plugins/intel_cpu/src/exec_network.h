@@ -36,7 +36,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const std::shared_ptr<const PrecomputedConstants>& precomputedConstants = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -68,6 +69,16 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // restored (instead of computed) by the graphs, e.g. for the imported network, released once the graphs are built
+    std::shared_ptr<const PrecomputedConstants> _precomputedConstants;
+    // the cache of the stateless values (e.g. the generated kernels) shared by the graphs of all the streams,
+    // see Node::getSharedRuntimeCache
+    MultiCachePtr                               _sharedRtParamsCache;
+    // the execution timeline of the network and the buffer of the async pipeline stage spans of all the requests,
+    // not set if the tracing is disabled, see Config::executionTracePath
+    ExecutionTrace::Ptr                         _executionTrace;
+    TraceBuffer::Ptr                            _pipelineTraceBuffer;
+    uint32_t                                    _pipelineStageTraceName = 0;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
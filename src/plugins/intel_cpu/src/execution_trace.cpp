@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "execution_trace.h"
+
+#include <iomanip>
+
+#include <ie_common.h>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+const char* categoryName(TraceCategory category) {
+    switch (category) {
+    case TraceCategory::Node:
+        return "node";
+    case TraceCategory::InferRequest:
+        return "infer_request";
+    case TraceCategory::PipelineStage:
+        return "pipeline_stage";
+    }
+    return "unknown";
+}
+
+void writeJsonString(std::ostream& os, const std::string& str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                   << std::dec << std::setfill(' ');
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+void writeMicroseconds(std::ostream& os, uint64_t ns) {
+    os << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000 << std::setfill(' ');
+}
+
+}  // namespace
+
+TraceBuffer::TraceBuffer(std::string label, size_t capacity, std::chrono::steady_clock::time_point origin)
+    : label(std::move(label)), origin(origin) {
+    size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    spans.resize(size);
+    mask = size - 1;
+}
+
+std::vector<TraceBuffer::Span> TraceBuffer::getSpans() const {
+    const auto recorded = head.load(std::memory_order_acquire);
+    const auto first = recorded > spans.size() ? recorded - spans.size() : 0;
+    std::vector<Span> result;
+    result.reserve(recorded - first);
+    for (auto i = first; i < recorded; i++)
+        result.push_back(spans[i & mask]);
+    return result;
+}
+
+uint32_t TraceBuffer::currentThreadIndex() noexcept {
+    static std::atomic<uint32_t> threadsCount{0};
+    thread_local const uint32_t index = threadsCount.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+ExecutionTrace::ExecutionTrace(const std::string& path, size_t bufferCapacity)
+    : file(path), bufferCapacity(bufferCapacity), origin(std::chrono::steady_clock::now()) {
+    if (!file.is_open())
+        IE_THROW() << "Cannot open the execution trace file " << path;
+}
+
+ExecutionTrace::~ExecutionTrace() {
+    dump(file);
+}
+
+TraceBuffer::Ptr ExecutionTrace::createBuffer(const std::string& label) {
+    auto buffer = std::make_shared<TraceBuffer>(label, bufferCapacity, origin);
+    std::lock_guard<std::mutex> lock(mutex);
+    buffers.push_back(buffer);
+    return buffer;
+}
+
+uint32_t ExecutionTrace::registerName(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    names.push_back(name);
+    return static_cast<uint32_t>(names.size() - 1);
+}
+
+void ExecutionTrace::addCacheStatistics(const std::string& name, MultiCacheCPtr cache) {
+    std::lock_guard<std::mutex> lock(mutex);
+    caches.emplace_back(name, std::move(cache));
+}
+
+void ExecutionTrace::dump(std::ostream& os) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (size_t pid = 0; pid < buffers.size(); pid++) {
+        const auto& buffer = buffers[pid];
+        os << (first ? "" : ",") << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"args\":{\"name\":";
+        writeJsonString(os, buffer->getLabel());
+        os << "}}";
+        first = false;
+
+        for (const auto& span : buffer->getSpans()) {
+            os << ",\n{\"name\":";
+            writeJsonString(os, span.name < names.size() ? names[span.name] : std::string());
+            os << ",\"cat\":\"" << categoryName(span.category) << "\",\"ph\":\"X\",\"pid\":" << pid
+               << ",\"tid\":" << span.thread << ",\"ts\":";
+            writeMicroseconds(os, span.begin);
+            os << ",\"dur\":";
+            writeMicroseconds(os, span.end - span.begin);
+            if (span.detail < names.size()) {
+                os << ",\"args\":{\"type\":";
+                writeJsonString(os, names[span.detail]);
+                os << "}";
+            }
+            os << "}";
+        }
+    }
+    if (!caches.empty()) {
+        const auto pid = buffers.size();
+        const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin);
+        os << (first ? "" : ",") << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+           << ",\"args\":{\"name\":\"Runtime caches\"}}";
+        for (const auto& cache : caches) {
+            const auto statistics = cache.second->getStatistics();
+            os << ",\n{\"name\":";
+            writeJsonString(os, cache.first);
+            os << ",\"cat\":\"runtime_cache\",\"ph\":\"C\",\"pid\":" << pid << ",\"ts\":";
+            writeMicroseconds(os, ts.count());
+            os << ",\"args\":{\"hits\":" << statistics.hits << ",\"misses\":" << statistics.misses
+               << ",\"evictions\":" << statistics.evictions << "}}";
+        }
+    }
+    os << "\n]}\n";
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cache/multi_cache.h"
+
+namespace ov {
+namespace intel_cpu {
+
+enum class TraceCategory : uint32_t {
+    Node,
+    InferRequest,
+    PipelineStage,
+};
+
+/**
+ * @brief Fixed size ring buffer of the execution time spans, the oldest spans are overwritten on the overflow.
+ * The slots are claimed by the atomic increment, so the spans are recorded without locks by any number of threads
+ * (e.g. by the nodes of the same level executed concurrently). The buffer is read only by the dump, when no more
+ * spans are recorded.
+ */
+class TraceBuffer {
+public:
+    using Ptr = std::shared_ptr<TraceBuffer>;
+
+    struct Span {
+        uint64_t begin;      // ns since the trace start
+        uint64_t end;
+        uint32_t name;       // ids of the names registered in the trace
+        uint32_t detail;
+        uint32_t thread;     // index of the recording thread
+        TraceCategory category;
+    };
+
+    static constexpr uint32_t noDetail = UINT32_MAX;
+
+    TraceBuffer(std::string label, size_t capacity, std::chrono::steady_clock::time_point origin);
+
+    uint64_t now() const noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    void record(TraceCategory category, uint32_t name, uint32_t detail, uint64_t begin, uint64_t end) noexcept {
+        const auto index = head.fetch_add(1, std::memory_order_relaxed);
+        spans[index & mask] = {begin, end, name, detail, currentThreadIndex(), category};
+    }
+
+    const std::string& getLabel() const {
+        return label;
+    }
+
+    // the recorded spans in the order of recording, up to the capacity of the latest ones
+    std::vector<Span> getSpans() const;
+
+private:
+    static uint32_t currentThreadIndex() noexcept;
+
+    std::string label;
+    std::vector<Span> spans;
+    size_t mask;
+    std::atomic<uint64_t> head{0};
+    std::chrono::steady_clock::time_point origin;
+};
+
+/**
+ * @brief Records the time span of the scope to the buffer, does nothing if the buffer is not set
+ */
+class TraceScope {
+public:
+    TraceScope(TraceBuffer* buffer, TraceCategory category, uint32_t name, uint32_t detail = TraceBuffer::noDetail) noexcept
+        : buffer(buffer), category(category), name(name), detail(detail), begin(buffer ? buffer->now() : 0) {}
+
+    ~TraceScope() {
+        if (buffer)
+            buffer->record(category, name, detail, begin, buffer->now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    TraceBuffer* buffer;
+    TraceCategory category;
+    uint32_t name;
+    uint32_t detail;
+    uint64_t begin;
+};
+
+/**
+ * @brief Execution timeline of the network: the spans of the nodes (a buffer per stream graph), of the infer requests
+ * and of the asynchronous pipeline stages. The names are registered once (e.g. on the graph creation), so only
+ * the timestamps and the name ids are recorded on the execution. The timeline is written to the file in the Chrome
+ * trace event format (viewed by chrome://tracing or Perfetto) on the destruction, see Config::executionTracePath.
+ * The look up statistics of the runtime caches are written as the counters at the end of the timeline.
+ */
+class ExecutionTrace {
+public:
+    using Ptr = std::shared_ptr<ExecutionTrace>;
+
+    // the number of the latest spans kept by each buffer
+    static constexpr size_t defaultBufferCapacity = 1 << 16;
+
+    // the file is created at once to report the wrong path on the network compilation
+    explicit ExecutionTrace(const std::string& path, size_t bufferCapacity = defaultBufferCapacity);
+    ~ExecutionTrace();
+
+    // the label is shown as the process name of the buffer timeline
+    TraceBuffer::Ptr createBuffer(const std::string& label);
+    uint32_t registerName(const std::string& name);
+    // the statistics are collected on the dump, so the cache is kept alive as long as the trace
+    void addCacheStatistics(const std::string& name, MultiCacheCPtr cache);
+
+    void dump(std::ostream& os) const;
+
+private:
+    std::ofstream file;
+    size_t bufferCapacity;
+    std::chrono::steady_clock::time_point origin;
+
+    mutable std::mutex mutex;
+    std::vector<TraceBuffer::Ptr> buffers;
+    std::deque<std::string> names;
+    std::vector<std::pair<std::string, MultiCacheCPtr>> caches;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
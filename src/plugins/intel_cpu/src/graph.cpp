@@ -25,6 +25,7 @@
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
+#include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -40,6 +41,7 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "ie_parallel.hpp"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <ngraph/node.hpp>
@@ -49,6 +51,7 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -76,6 +79,8 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
 
     Replicate(net, extMgr);
     InitGraph();
+    if (executionTrace)
+        InitExecutionTrace();
 
     status = Ready;
 
@@ -150,6 +155,7 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setSharedRuntimeCache(sharedRtParamsCache);
 
         graphNodes.push_back(node);
 
@@ -175,6 +181,10 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const Ex
             graphEdges.push_back(edge);
         }
 
+        if (node->getType() == Type::FullyConnected) {
+            std::static_pointer_cast<node::FullyConnected>(node)->initSparseWeightsDecompression(config.fcSparseWeiDecompressionRate);
+        }
+
         if (!one_of(op->get_type_info(),
                 ngraph::op::v0::Result::get_type_info_static(),
                 ngraph::op::v3::Assign::get_type_info_static(),
@@ -262,6 +272,7 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setSharedRuntimeCache(sharedRtParamsCache);
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -294,6 +305,10 @@ void Graph::Replicate(const CNNNetwork &network, const ExtensionManager::Ptr& ex
             graphEdges.push_back(edge);
         }
 
+        if (node->getType() == Type::FullyConnected) {
+            std::static_pointer_cast<node::FullyConnected>(node)->initSparseWeightsDecompression(config.fcSparseWeiDecompressionRate);
+        }
+
         if (!one_of(op->get_type_info(),
                 ngraph::op::v0::Result::get_type_info_static(),
                 ngraph::op::v3::Assign::get_type_info_static(),
@@ -392,6 +407,8 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -404,6 +421,25 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+    // the precomputed data is already copied to the constant edges
+    precomputedConstants.reset();
+}
+
+void Graph::InitExecutionTrace() {
+    if (!traceBuffer) {
+        traceBuffer = executionTrace->createBuffer("Stream " + std::to_string(traceStreamId));
+        executionTrace->addCacheStatistics("Stream " + std::to_string(traceStreamId) + " runtime cache", rtParamsCache);
+    }
+    inferRequestTraceName = executionTrace->registerName("Infer request");
+
+    std::unordered_map<std::string, uint32_t> typeNames;
+    nodeTraceNames.resize(graphNodes.size());
+    for (const auto& node : graphNodes) {
+        auto typeName = typeNames.find(node->getTypeStr());
+        if (typeName == typeNames.end())
+            typeName = typeNames.emplace(node->getTypeStr(), executionTrace->registerName(node->getTypeStr())).first;
+        nodeTraceNames[node->execIndex] = {executionTrace->registerName(node->getName()), typeName->second};
+    }
 }
 
 void Graph::InitNodes() {
@@ -460,6 +496,51 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (!execLevels.empty()) {
+        for (const auto& node : executableGraphNodes) {
+            const size_t level = execLevels[node->execIndex];
+            if (executableGraphLevels.size() <= level)
+                executableGraphLevels.resize(level + 1);
+            executableGraphLevels[level].emplace_back(node);
+        }
+        // levels consisting of non-executable nodes only
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<NodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
+}
+
+namespace {
+// the constant subgraph results consumed by the rest of the graph, which own the memory
+// (so neither views of the model constants nor the in-place memory of the consumers)
+bool isPrecomputableConstant(const EdgePtr& edge) {
+    const auto parent = edge->getParent();
+    const auto child = edge->getChild();
+    return parent->isConstant() && !child->isConstant() && parent->getType() != Type::Input &&
+           !parent->isInPlace() && !child->isInPlace() && edge->getMemory().getDesc().isDefined();
+}
+
+std::string getConstantSignature(const Memory& memory) {
+    const auto& desc = memory.getDesc();
+    return std::string(desc.getPrecision().name()) + " " + desc.getShape().toString() + " " + desc.serializeFormat() +
+           " " + std::to_string(memory.GetSize());
+}
+}  // namespace
+
+PrecomputedConstants Graph::GetPrecomputedConstants() const {
+    PrecomputedConstants constants;
+    for (const auto& node : constantGraphNodes) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            if (!isPrecomputableConstant(edge))
+                continue;
+            const auto& memory = edge->getMemory();
+            const auto data = static_cast<const uint8_t*>(memory.GetData());
+            constants[edge->name()] = {getConstantSignature(memory), {data, data + memory.GetSize()}};
+        }
+    }
+    return constants;
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -490,7 +571,50 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    auto restorePrecomputed = [this](const EdgePtr& edge) {
+        if (!isPrecomputableConstant(edge))
+            return false;
+        const auto precomputed = precomputedConstants->find(edge->name());
+        if (precomputed == precomputedConstants->end())
+            return false;
+        auto& memory = edge->getMemory();
+        if (precomputed->second.signature != getConstantSignature(memory))
+            return false;
+        if (edge->isUseExternalMemory()) {
+            auto ptr = weightsCache->get(edge->name());
+            if (!ptr->isValid()) {
+                cpu_memcpy(memory.GetData(), precomputed->second.data.data(), precomputed->second.data.size());
+                ptr->valid(true);
+            }
+        } else {
+            cpu_memcpy(memory.GetData(), precomputed->second.data.data(), precomputed->second.data.size());
+        }
+        return true;
+    };
+
+    // the constant nodes, whose results are either restored from the precomputed data (e.g. of the imported
+    // network) or consumed only by the nodes not executed as well, are skipped
+    std::unordered_set<NodePtr> executedNodes;
+    if (precomputedConstants) {
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            bool execute = node->getChildEdges().empty();
+            for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+                const auto edge = node->getChildEdgeAt(i);
+                const auto child = edge->getChild();
+                if (child->isConstant())
+                    execute = execute || executedNodes.count(child);
+                else
+                    execute = !restorePrecomputed(edge) || execute;
+            }
+            if (execute)
+                executedNodes.insert(node);
+        }
+    }
+
     for (const auto &node : constantGraphNodes) {
+        if (precomputedConstants && !executedNodes.count(node))
+            continue;
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -599,14 +723,15 @@ static inline bool isConstOutput(EdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
-static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges) {
+// clusters of the edges sharing the memory, of either defined or undefined (dynamic shapes) upper bound
+static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges, bool definedMaxSize = true) {
     typedef std::unordered_map<EdgePtr, size_t> edge_cluster_idx_map_t;
 
     edge_clusters_t edge_clusters;
     edge_cluster_idx_map_t edge_cluster_indices;
 
     for (auto &edge : graphEdges) {
-        if (!edge->hasDefinedMaxSize())
+        if (edge->hasDefinedMaxSize() != definedMaxSize)
             continue;
 
         auto edge_it = edge_cluster_indices.find(edge);
@@ -624,7 +749,7 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
         for (auto shared_edge = edge->getSharedEdge(std::nothrow);
             shared_edge;
             shared_edge = shared_edge->getSharedEdge(std::nothrow)) {
-            has_defined_max_path = has_defined_max_path && shared_edge->hasDefinedMaxSize();
+            has_defined_max_path = has_defined_max_path && shared_edge->hasDefinedMaxSize() == definedMaxSize;
             auto shared_edge_it = edge_cluster_indices.find(shared_edge);
             if (shared_edge_it != edge_cluster_indices.end()) {
                 cluster_idx = shared_edge_it->second;
@@ -656,6 +781,34 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+void Graph::InitExecLevels() {
+    execLevels.clear();
+    if (!config.parallelGraphExecution)
+        return;
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // The dynamic nodes reallocate the memory on the fly, and the Memory nodes depend on each other
+    // without the edges, so such graphs are executed sequentially
+    const bool unsupported = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+    if (unsupported)
+        return;
+
+    // the level of the node is the length of the longest path from the graph inputs,
+    // so the nodes of the same level never depend on each other
+    execLevels.resize(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, execLevels[parent->execIndex] + 1);
+        }
+        execLevels[node->execIndex] = level;
+    }
+#endif
+    // with OpenMP the nested parallel regions of the nodes would be serialized, so the sequential execution is kept
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -694,8 +847,10 @@ void Graph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // in case of the parallel execution the life time is measured in levels, as the levels are executed
+            // one after another, while the nodes of the same level (and so their outputs) live concurrently
+            int e_start = execLevels.empty() ? edge->getParent()->execIndex : execLevels[edge->getParent()->execIndex];
+            int e_finish = execLevels.empty() ? edge->getChild()->execIndex : execLevels[edge->getChild()->execIndex];
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -782,6 +937,169 @@ void Graph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    InitDynamicMemory();
+}
+
+void Graph::InitDynamicMemory() {
+    dynamicMemoryClusters.clear();
+    // the clusters are collected with the reuse disabled as well, their sizes are summed up for the peak
+
+    // the memory bound to the infer request blobs, the memory states and the memory of the nodes with
+    // the inner graphs is managed by its owners, so it is kept out of the arena
+    auto isManagedExternally = [](const NodePtr& node) {
+        return node->isConstant() || one_of(node->getType(), Type::Input, Type::Output, Type::MemoryInput,
+                                            Type::MemoryOutput, Type::TensorIterator, Type::If);
+    };
+
+    for (const auto& cluster : findEdgeClusters(graphEdges, false)) {
+        DynamicMemoryCluster dynamicCluster{nullptr, {}, {}, std::numeric_limits<int>::max(), 0, nullptr, 0, 0};
+        bool managedExternally = false;
+        for (const auto& edge : cluster) {
+            const auto parent = edge->getParent();
+            const auto child = edge->getChild();
+            managedExternally = managedExternally || isManagedExternally(parent) || isManagedExternally(child);
+            dynamicCluster.start = std::min(dynamicCluster.start, parent->execIndex);
+            dynamicCluster.finish = std::max(dynamicCluster.finish, child->execIndex);
+            for (const auto& node : {parent, child}) {
+                if (std::find(dynamicCluster.nodes.begin(), dynamicCluster.nodes.end(), node) == dynamicCluster.nodes.end())
+                    dynamicCluster.nodes.push_back(node);
+            }
+            dynamicCluster.edges.push_back(edge);
+            if (!edge->getSharedEdge(std::nothrow))
+                dynamicCluster.mngr = edge->getMemoryPtr()->getDnnlMemoryMngr();
+        }
+        if (!managedExternally && dynamicCluster.mngr && !dynamicCluster.mngr->hasExtBuffer())
+            dynamicMemoryClusters.push_back(std::move(dynamicCluster));
+    }
+
+    dynamicMemoryStarts.clear();
+    dynamicMemoryFinishes.clear();
+    if (!config.dynamicMemoryReuse || dynamicMemoryClusters.empty())
+        return;
+    dynamicMemoryStarts.resize(graphNodes.size());
+    dynamicMemoryFinishes.resize(graphNodes.size());
+    for (size_t i = 0; i < dynamicMemoryClusters.size(); i++) {
+        dynamicMemoryStarts[dynamicMemoryClusters[i].start].push_back(i);
+        dynamicMemoryFinishes[dynamicMemoryClusters[i].finish].push_back(i);
+    }
+}
+
+void Graph::ApplyDynamicMemoryPlan(const DynamicShapePlan& plan) {
+    if (plan.memoryPlanId == 0 || plan.memoryPlanId == appliedMemoryPlanId)
+        return;
+
+    if (plan.memorySize > dynamicMemoryArenaSize) {
+        dynamicMemoryArena.resize(plan.memorySize);
+        dynamicMemoryArenaSize = plan.memorySize;
+    }
+    auto* arena = static_cast<uint8_t*>(dynamicMemoryArena.getRawPtr());
+
+    for (size_t i = 0; i < dynamicMemoryClusters.size(); i++) {
+        auto& cluster = dynamicMemoryClusters[i];
+        void* ptr = arena + plan.memoryOffsets[i];
+        const bool moved = cluster.mngr->getRawPtr() != ptr;
+        // the memory grows beyond the planned size (e.g. for the new or the data dependent shapes) in a separate
+        // buffer, which is released once the memory is consumed, see ReleaseSeparateMemory
+        cluster.mngr->setExtBuff(ptr, plan.memorySizes[i]);
+        cluster.arenaPtr = ptr;
+        cluster.arenaSize = plan.memorySizes[i];
+        if (moved) {
+            // the nodes may keep the memory pointers in the prepared params
+            for (const auto& node : cluster.nodes)
+                node->lastInputDims.clear();
+        }
+    }
+    appliedMemoryPlanId = plan.memoryPlanId;
+}
+
+size_t Graph::GetDynamicClusterSize(const DynamicMemoryCluster& cluster) {
+    size_t size = 0;
+    for (const auto& edge : cluster.edges) {
+        const auto& desc = edge->getMemory().getDesc();
+        if (desc.isDefined())
+            size = std::max(size, desc.getCurrentMemSize());
+    }
+    return size;
+}
+
+void Graph::UpdateDynamicMemoryPeak() {
+    // every cluster has its own buffer
+    size_t memorySize = 0;
+    for (const auto& cluster : dynamicMemoryClusters)
+        memorySize += GetDynamicClusterSize(cluster);
+    if (memorySize > dynamicMemoryPeak)
+        dynamicMemoryPeak = memorySize;
+}
+
+void Graph::ReleaseSeparateMemory(int execIndex) {
+    for (const auto i : dynamicMemoryStarts[execIndex]) {
+        auto& cluster = dynamicMemoryClusters[i];
+        if (!cluster.mngr->hasExtBuffer() && cluster.separateSize == 0) {
+            cluster.separateSize = GetDynamicClusterSize(cluster);
+            separateMemorySize += cluster.separateSize;
+        }
+    }
+    separateMemoryPeak = std::max(separateMemoryPeak, separateMemorySize);
+
+    // the separate buffers are freed right after the last consumer, so the tensors of the disjoint lifetimes
+    // do not hold them at once even if the memory is not planned for the input shapes yet
+    for (const auto i : dynamicMemoryFinishes[execIndex]) {
+        auto& cluster = dynamicMemoryClusters[i];
+        if (cluster.mngr->hasExtBuffer())
+            continue;
+        if (cluster.separateSize == 0) {
+            // the in-place memory may grow after the producer
+            separateMemoryPeak = std::max(separateMemoryPeak, separateMemorySize + GetDynamicClusterSize(cluster));
+        }
+        separateMemorySize -= cluster.separateSize;
+        cluster.separateSize = 0;
+        cluster.mngr->setExtBuff(cluster.arenaPtr, cluster.arenaSize);
+        // the nodes may keep the pointers to the freed buffer in the prepared params
+        for (const auto& node : cluster.nodes)
+            node->lastInputDims.clear();
+    }
+}
+
+void Graph::UpdateDynamicMemoryPlan(DynamicShapePlan& plan) {
+    const size_t clustersNum = dynamicMemoryClusters.size();
+    std::vector<size_t> sizes(clustersNum, 0);
+    bool fits = plan.memoryPlanId != 0;
+    for (size_t i = 0; i < clustersNum; i++) {
+        const auto& cluster = dynamicMemoryClusters[i];
+        sizes[i] = GetDynamicClusterSize(cluster);
+        // the consumer is not executed (e.g. the in-place one), so the buffer is released with the next plan
+        if (!cluster.mngr->hasExtBuffer() && cluster.separateSize == 0)
+            separateMemoryPeak += sizes[i];
+        fits = fits && sizes[i] <= plan.memorySizes[i];
+    }
+
+    const size_t memorySize = dynamicMemoryArenaSize + separateMemoryPeak;
+    if (memorySize > dynamicMemoryPeak)
+        dynamicMemoryPeak = memorySize;
+
+    if (fits)
+        return;
+
+    // the sizes never shrink, so the data dependent shapes do not cause the planning on each inference
+    if (plan.memoryPlanId != 0) {
+        for (size_t i = 0; i < clustersNum; i++)
+            sizes[i] = std::max(sizes[i], plan.memorySizes[i]);
+    }
+
+    const size_t alignment = 64;  // 64 bytes, the cache line
+    std::vector<MemorySolver::Box> boxes(clustersNum);
+    for (size_t i = 0; i < clustersNum; i++) {
+        const auto& cluster = dynamicMemoryClusters[i];
+        boxes[i] = {cluster.start, cluster.finish, static_cast<int64_t>(div_up(sizes[i], alignment)), static_cast<int64_t>(i)};
+    }
+    MemorySolver memSolver(boxes);
+    plan.memorySize = static_cast<size_t>(memSolver.solve()) * alignment;
+    plan.memoryOffsets.resize(clustersNum);
+    for (size_t i = 0; i < clustersNum; i++)
+        plan.memoryOffsets[i] = static_cast<size_t>(memSolver.getOffset(static_cast<int>(i))) * alignment;
+    plan.memorySizes = std::move(sizes);
+    plan.memoryPlanId = ++dynamicMemoryPlanId;
 }
 
 void Graph::CreatePrimitives() {
@@ -942,12 +1260,14 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
-inline void Graph::ExecuteNode(const NodePtr& node, const mkldnn::stream& stream) const {
+inline void Graph::ExecuteNode(const NodePtr& node, const mkldnn::stream& stream, DynamicShapePlan* plan) const {
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
+    const auto traceNames = traceBuffer ? nodeTraceNames[node->execIndex] : NodeTraceNames{0, TraceBuffer::noDetail};
+    TraceScope traceScope(traceBuffer.get(), TraceCategory::Node, traceNames.name, traceNames.type);
 
     if (node->isDynamicNode()) {
-        node->executeDynamic(stream);
+        node->executeDynamic(stream, plan ? &plan->records[node->execIndex] : nullptr);
     } else {
         node->execute(stream);
     }
@@ -960,18 +1280,91 @@ void Graph::Infer(InferRequestBase* request) {
 
     mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    // the shape inference results and the memory solution are reused for the repeated input shapes
+    DynamicShapePlan* plan = graphHasDynamicInput ? GetDynamicShapePlan() : nullptr;
+    const bool planMemory = config.dynamicMemoryReuse && plan && !dynamicMemoryClusters.empty();
+    if (planMemory) {
+        ApplyDynamicMemoryPlan(*plan);
+        for (auto& cluster : dynamicMemoryClusters)
+            cluster.separateSize = 0;
+        separateMemorySize = 0;
+        separateMemoryPeak = 0;
+    }
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+    if (!executableGraphLevels.empty()) {
+        for (const auto& level : executableGraphLevels) {
+            if (request)
+                request->ThrowIfCanceled();
+            if (level.size() == 1) {
+                VERBOSE(level.front(), config.verbose);
+                PERF(level.front(), config.collectPerfCounters);
+                ExecuteNode(level.front(), stream, plan);
+                continue;
+            }
+            parallel_for(level.size(), [&](size_t i) {
+                const auto& node = level[i];
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+                // the stream is not meant to be shared by the concurrently executed primitives
+                mkldnn::stream nodeStream(eng);
+                ExecuteNode(node, nodeStream, plan);
+            });
+        }
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream, plan);
+            if (planMemory)
+                ReleaseSeparateMemory(node->execIndex);
+        }
     }
 
+    if (planMemory)
+        UpdateDynamicMemoryPlan(*plan);
+    else if (!dynamicMemoryClusters.empty())
+        UpdateDynamicMemoryPeak();
+
     if (infer_count != -1) infer_count++;
 }
 
+size_t Graph::ShapeSignature::hash() const {
+    size_t seed = 0;
+    for (const auto& inputDims : dims) {
+        seed = dnnl::impl::hash_combine(seed, inputDims.size());
+        for (const auto dim : inputDims)
+            seed = dnnl::impl::hash_combine(seed, dim);
+    }
+    return seed;
+}
+
+DynamicShapePlan* Graph::GetDynamicShapePlan() {
+    ShapeSignature signature;
+    signature.dims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& edges = input.second->getChildEdges();
+        signature.dims.push_back(edges.empty() ? VectorDims{} : input.second->getChildEdgeAt(0)->getMemory().getStaticDims());
+    }
+
+    // the same shapes as the previous inference, the nodes skip the shape inference and prepareParams by themselves
+    if (lastDynamicShapePlan && signature == lastShapeSignature)
+        return lastDynamicShapePlan.get();
+
+    auto plan = dynamicShapePlans.get(signature);
+    if (!plan) {
+        // the records are filled by the nodes during the first execution with the signature
+        plan = std::make_shared<DynamicShapePlan>();
+        plan->records.resize(graphNodes.size());
+        dynamicShapePlans.put(signature, plan);
+    }
+    lastShapeSignature = std::move(signature);
+    lastDynamicShapePlan = plan;
+    return plan.get();
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1302,6 +1695,7 @@ bool Graph::InsertNode(NodePtr parent, NodePtr child, NodePtr node, int parentPo
         node->setQuantizedGraphFlag(true);
     }
     node->setRuntimeCache(rtParamsCache);
+    node->setSharedRuntimeCache(sharedRtParamsCache);
 
     if (initNode) {
         node->getSupportedDescriptors();
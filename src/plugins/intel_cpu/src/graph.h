@@ -11,11 +11,14 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
+#include "execution_trace.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
 
 namespace ov {
 namespace intel_cpu {
@@ -23,6 +26,31 @@ namespace intel_cpu {
 class InferRequestBase;
 class InferRequest;
 
+/**
+ * @brief Data of the constant subgraph results consumed by the rest of the graph
+ * (e.g. the weights reordered to the blocked layouts)
+ */
+struct PrecomputedConstant {
+    std::string signature;  // precision, shape and layout of the data
+    std::vector<uint8_t> data;
+};
+// keyed by the edge name
+using PrecomputedConstants = std::unordered_map<std::string, PrecomputedConstant>;
+
+/**
+ * @brief The shape inference results of the graph nodes (indexed by the node execIndex) and the memory solution
+ * for the dynamic shape tensors recorded for an input shape signature of the dynamic graph
+ */
+struct DynamicShapePlan {
+    std::vector<ShapeInferRecord> records;
+    // the offsets and the sizes (in bytes) of the dynamic memory clusters in the arena, see Config::dynamicMemoryReuse
+    std::vector<size_t> memoryOffsets;
+    std::vector<size_t> memorySizes;
+    size_t memorySize = 0;
+    // unique id of the memory solution, 0 if the memory is not planned yet
+    size_t memoryPlanId = 0;
+};
+
 class Graph {
 public:
     typedef std::shared_ptr<Graph> Ptr;
@@ -68,6 +96,30 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    // collects the results of the constant subgraphs, to be restored (instead of the execution) in another graph
+    PrecomputedConstants GetPrecomputedConstants() const;
+    // must be set before the graph creation, released once the constant nodes are restored
+    void SetPrecomputedConstants(std::shared_ptr<const PrecomputedConstants> constants) {
+        precomputedConstants = std::move(constants);
+    }
+    // the cache of the stateless values shared with the graphs of the other streams, see Node::getSharedRuntimeCache,
+    // must be set before the graph creation
+    void SetSharedRuntimeCache(MultiCachePtr cache) {
+        sharedRtParamsCache = std::move(cache);
+    }
+    // the execution timeline the graph of the stream records the node spans to, must be set before the graph creation
+    void SetExecutionTrace(ExecutionTrace::Ptr trace, int streamId) {
+        executionTrace = std::move(trace);
+        traceStreamId = streamId;
+    }
+    // the buffer of the graph spans, nullptr if the tracing is disabled
+    TraceBuffer* GetTraceBuffer() const {
+        return traceBuffer.get();
+    }
+    uint32_t GetInferRequestTraceName() const {
+        return inferRequestTraceName;
+    }
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -193,6 +245,14 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Returns the peak size in bytes of the memory of the dynamic shape tensors, see Config::dynamicMemoryReuse.
+     * With the reuse disabled it is the peak of the sum of the tensor sizes
+     */
+    size_t GetDynamicMemoryPeak() const {
+        return dynamicMemoryPeak;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -205,6 +265,13 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        dynamicShapePlans = DynamicShapePlans(dynamicShapePlansCapacity);
+        lastShapeSignature = {};
+        lastDynamicShapePlan.reset();
+        dynamicMemoryClusters.clear();
+        dynamicMemoryStarts.clear();
+        dynamicMemoryFinishes.clear();
+        appliedMemoryPlanId = 0;
     }
     Status status { NotReady };
     Config config;
@@ -226,6 +293,12 @@ protected:
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
 
+    // levels of the mutually independent nodes (indexed by execIndex), set only for the parallel execution,
+    // see Config::parallelGraphExecution
+    std::vector<int> execLevels;
+
+    std::shared_ptr<const PrecomputedConstants> precomputedConstants;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const ExtensionManager::Ptr& extMgr);
@@ -237,10 +310,18 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitExecLevels();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
-    void ExecuteNode(const NodePtr& node, const mkldnn::stream& stream) const;
+    void ExecuteNode(const NodePtr& node, const mkldnn::stream& stream, DynamicShapePlan* plan = nullptr) const;
+    DynamicShapePlan* GetDynamicShapePlan();
+    void InitDynamicMemory();
+    void ApplyDynamicMemoryPlan(const DynamicShapePlan& plan);
+    void UpdateDynamicMemoryPlan(DynamicShapePlan& plan);
+    void UpdateDynamicMemoryPeak();
+    void ReleaseSeparateMemory(int execIndex);
     void ExecuteConstantNodesOnly() const;
+    void InitExecutionTrace();
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -257,8 +338,69 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
+    // executable nodes grouped by the levels, the nodes of the same level are executed concurrently
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
 
     MultiCachePtr rtParamsCache;
+    MultiCachePtr sharedRtParamsCache;
+
+    // the static dims of the graph inputs
+    struct ShapeSignature {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const ShapeSignature& rhs) const {
+            return dims == rhs.dims;
+        }
+    };
+
+    // the number of the input shape signatures the plans are kept for
+    static constexpr size_t dynamicShapePlansCapacity = 64;
+    using DynamicShapePlans = LruCache<ShapeSignature, std::shared_ptr<DynamicShapePlan>>;
+    DynamicShapePlans dynamicShapePlans{dynamicShapePlansCapacity};
+    // the plan of the previous inference, is not looked up again while the input shapes don't change
+    ShapeSignature lastShapeSignature;
+    std::shared_ptr<DynamicShapePlan> lastDynamicShapePlan;
+
+    // edges of unknown upper bound sharing the memory, which is placed to the arena, see Config::dynamicMemoryReuse
+    struct DynamicMemoryCluster {
+        DnnlMemoryMngrPtr mngr;
+        // the producers and the consumers of the memory, which have to prepare the params again once it is moved
+        std::vector<NodePtr> nodes;
+        std::vector<EdgePtr> edges;
+        int start;
+        int finish;
+        // the planned place of the memory in the arena
+        void* arenaPtr;
+        size_t arenaSize;
+        // the size of the separate buffer of the memory grown beyond the planned size, 0 if the arena is used
+        size_t separateSize;
+    };
+    static size_t GetDynamicClusterSize(const DynamicMemoryCluster& cluster);
+    std::vector<DynamicMemoryCluster> dynamicMemoryClusters;
+    // the indices of the clusters produced and last consumed by the node, indexed by the node execIndex
+    std::vector<std::vector<size_t>> dynamicMemoryStarts;
+    std::vector<std::vector<size_t>> dynamicMemoryFinishes;
+    // the size of the separate buffers of the current inference and its peak
+    size_t separateMemorySize = 0;
+    size_t separateMemoryPeak = 0;
+    MemoryMngrWithReuse dynamicMemoryArena;
+    size_t dynamicMemoryArenaSize = 0;
+    size_t dynamicMemoryPlanId = 0;
+    size_t appliedMemoryPlanId = 0;
+    std::atomic<size_t> dynamicMemoryPeak{0};
+
+    // see Config::executionTracePath
+    ExecutionTrace::Ptr executionTrace;
+    int traceStreamId = 0;
+    TraceBuffer::Ptr traceBuffer;
+    struct NodeTraceNames {
+        uint32_t name;
+        uint32_t type;
+    };
+    // indexed by the node execIndex
+    std::vector<NodeTraceNames> nodeTraceNames;
+    uint32_t inferRequestTraceName = 0;
 
     void EnforceBF16();
 };
@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -61,7 +62,14 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    // must be the first one, so the decompression operations are not fused into each other
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    if (graph.getProperty().fcWeightsDecompression) {
+        FuseFCAndWeightsDecompression(graph);
+        graph.RemoveDroppedNodes();
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -169,6 +177,98 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableFCNode = [](const NodePtr& node) {
+        return node->getType() == Type::FullyConnected &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::FP32 &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               node->getInputShapeAtPort(1).getRank() == 2 &&
+               node->getInputShapeAtPort(1).isStatic();
+    };
+
+    auto isConstantInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant() && node->getChildEdges().size() == 1;
+    };
+
+    for (const auto& fc : graphNodes) {
+        if (!isSuitableFCNode(fc))
+            continue;
+
+        const auto& weightsDims = fc->getInputShapeAtPort(1).getStaticDims();
+        const size_t N = weightsDims[0];
+        std::vector<float> scales(N, 1.f), shifts(N, 0.f);
+
+        // Constant -> Convert -> [Subtract|Add|Multiply by the per output channel Constant]* -> FullyConnected,
+        // the elementwise operations are collected bottom-up together with the index of the data input
+        std::vector<std::pair<NodePtr, size_t>> eltwises;
+        auto node = fc->getParentEdgesAtPort(1)[0]->getParent();
+        while (node->getType() == Type::Eltwise &&
+               one_of(node->getAlgorithm(), Algorithm::EltwiseMultiply, Algorithm::EltwiseAdd, Algorithm::EltwiseSubtract) &&
+               node->getParentEdges().size() == 2 && node->getChildEdges().size() == 1 && node->getFusedWith().empty()) {
+            // the same choice of the data input as in ConvertMatMulToFC
+            const size_t dataIdx = node->getAlgorithm() != Algorithm::EltwiseSubtract &&
+                                   node->getInputShapeAtPort(1).getElementsCount() > node->getInputShapeAtPort(0).getElementsCount() ? 1 : 0;
+            eltwises.emplace_back(node, dataIdx);
+            node = node->getParentEdgesAtPort(dataIdx)[0]->getParent();
+        }
+        if (node->getType() != Type::Convert || node->getChildEdges().size() != 1 ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        const auto convert = node;
+        const auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstantInput(weights) || !CompressedWeights::isSupportedPrecision(weights->getOriginalOutputPrecisionAtPort(0)))
+            continue;
+
+        bool supported = true;
+        for (auto it = eltwises.rbegin(); it != eltwises.rend() && supported; it++) {
+            const auto& eltwise = it->first;
+            const auto constant = std::dynamic_pointer_cast<node::Input>(eltwise->getParentEdgesAtPort(1 - it->second)[0]->getParent());
+            if (!constant || !isConstantInput(constant) || constant->getOriginalOutputPrecisionAtPort(0) != Precision::FP32) {
+                supported = false;
+                break;
+            }
+            // a scalar or the value per output channel
+            const auto& constShape = constant->getOutputShapeAtPort(0);
+            const auto& dims = constShape.getStaticDims();
+            const size_t size = constShape.getElementsCount();
+            if (size != 1 && (dims.size() != 2 || dims[0] != N || dims[1] != 1)) {
+                supported = false;
+                break;
+            }
+
+            const auto values = reinterpret_cast<const float*>(constant->getMemoryPtr()->GetPtr());
+            for (size_t n = 0; n < N; n++) {
+                const float value = values[size == 1 ? 0 : n];
+                switch (eltwise->getAlgorithm()) {
+                    case Algorithm::EltwiseMultiply:
+                        scales[n] *= value;
+                        shifts[n] *= value;
+                        break;
+                    case Algorithm::EltwiseAdd:
+                        shifts[n] += value;
+                        break;
+                    default:
+                        shifts[n] -= value;
+                        break;
+                }
+            }
+        }
+        if (!supported)
+            continue;
+
+        for (const auto& eltwise : eltwises) {
+            auto constEdge = eltwise.first->getParentEdgesAtPort(1 - eltwise.second)[0];
+            graph.RemoveEdge(constEdge);
+            graph.DropNode(eltwise.first);
+        }
+        graph.DropNode(convert);
+
+        std::static_pointer_cast<node::FullyConnected>(fc)->fuseWeightsDecompression(std::move(scales), std::move(shifts));
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -56,7 +56,10 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            if (graph->getConfig().zeroCopyStates)
+                memoryStates.emplace_back(new VariableStateDoubleBuffer(state_name, state_store));
+            else
+                memoryStates.emplace_back(new VariableState(state_name, state_store));
         }
     }
 }
@@ -93,6 +96,11 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
 }
 
 void InferRequestBase::PushStates() {
+    if (graph->getConfig().zeroCopyStates) {
+        BindStates();
+        return;
+    }
+
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
@@ -115,6 +123,11 @@ void InferRequestBase::PushStates() {
 }
 
 void InferRequestBase::PullStates() {
+    if (graph->getConfig().zeroCopyStates) {
+        CommitStates();
+        return;
+    }
+
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
@@ -136,6 +149,54 @@ void InferRequestBase::PullStates() {
     }
 }
 
+void InferRequestBase::BindStates() {
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == Type::MemoryInput) {
+            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+            }
+            auto cur_id = cur_node->getId();
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == cur_id) {
+                    auto cur_state = std::static_pointer_cast<VariableStateDoubleBuffer>(state);
+                    cur_node->bindState(cur_state->getReadPtr(), cur_state->getSize());
+                }
+            }
+        } else if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto cur_id = cur_node->getId();
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == cur_id) {
+                    auto cur_state = std::static_pointer_cast<VariableStateDoubleBuffer>(state);
+                    cur_node->bindState(cur_state->getWritePtr(), cur_state->getSize());
+                }
+            }
+        }
+    }
+}
+
+void InferRequestBase::CommitStates() {
+    // only the states which have been written by the Assign node are swapped
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto cur_id = cur_node->getId();
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == cur_id) {
+                    std::static_pointer_cast<VariableStateDoubleBuffer>(state)->commit();
+                }
+            }
+        }
+    }
+}
+
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -154,6 +215,7 @@ void InferRequestBase::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
+    TraceScope traceScope(graph->GetTraceBuffer(), TraceCategory::InferRequest, graph->GetInferRequestTraceName());
 
     ThrowIfCanceled();
 
@@ -322,6 +384,14 @@ void InferRequestBase::ThrowIfCanceled() const {
     }
 }
 
+TraceBuffer::Ptr InferRequestBase::GetPipelineTraceBuffer() const {
+    return execNetwork->_pipelineTraceBuffer;
+}
+
+uint32_t InferRequestBase::GetPipelineStageTraceName() const {
+    return execNetwork->_pipelineStageTraceName;
+}
+
 InferenceEngine::Precision
 InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
@@ -37,6 +37,13 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Returns the buffer of the asynchronous pipeline stage spans, nullptr if the tracing is disabled
+     */
+    TraceBuffer::Ptr GetPipelineTraceBuffer() const;
+
+    uint32_t GetPipelineStageTraceName() const;
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -61,6 +68,8 @@ protected:
 private:
     void PushStates();
     void PullStates();
+    void BindStates();
+    void CommitStates();
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
@@ -15,6 +15,27 @@ void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+VariableStateDoubleBuffer::VariableStateDoubleBuffer(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    const auto tensorDesc = MemoryDescUtils::convertToTensorDesc(storage->getDesc());
+    state = make_blob_with_precision(tensorDesc);
+    state->allocate();
+    cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+    next = make_blob_with_precision(tensorDesc);
+    next->allocate();
+}
+
+void VariableStateDoubleBuffer::Reset() {
+    std::memset(state->buffer(), 0, state->byteSize());
+}
+
+void VariableStateDoubleBuffer::SetState(const Blob::Ptr& newState) {
+    // the storage is bound to the graph, so the user blob is copied instead of being kept
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Variable state " << name << " can't be set: expected blob of " << state->byteSize()
+                   << " bytes, but got " << newState->byteSize();
+    cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -27,5 +27,38 @@ public:
     void Reset() override;
 };
 
+/**
+ * @brief Variable state which storage is used by the ReadValue/Assign graph nodes in place.
+ * ReadValue reads the current value and Assign writes into the second buffer, then the buffers
+ * are swapped by commit(). Thus no copies of the state are done on the inference path.
+ */
+class VariableStateDoubleBuffer : public InferenceEngine::IVariableStateInternal {
+public:
+    VariableStateDoubleBuffer(std::string name, MemoryPtr storage);
+
+    void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    void* getReadPtr() const {
+        return state->buffer().as<void*>();
+    }
+    void* getWritePtr() const {
+        return next->buffer().as<void*>();
+    }
+    size_t getSize() const {
+        return state->byteSize();
+    }
+
+    /**
+     * @brief Makes the value written by Assign the current state value
+     */
+    void commit() {
+        std::swap(state, next);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr next;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
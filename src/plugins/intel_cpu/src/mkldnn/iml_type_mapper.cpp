@@ -37,6 +37,7 @@ impl_desc_type parse_impl_name(std::string impl_desc_name) {
     SEARCH_WORD(_1x1);
     SEARCH_WORD(_dw);
     SEARCH_WORD(reorder);
+    SEARCH_WORD(sparse);
     if ((res & impl_desc_type::avx2) != impl_desc_type::avx2 &&
         (res & impl_desc_type::avx512) != impl_desc_type::avx512)
         SEARCH_WORD(avx);
@@ -63,6 +64,7 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(unknown);
     CASE(undef);
     CASE(ref_any);
+    CASE(ref_sparse);
     CASE(reorder);
     CASE(gemm_any);
     CASE(gemm_blas);
@@ -35,9 +35,12 @@ enum impl_desc_type {
     reorder = 1<<22,
     // winograd
     winograd = 1<<23,
+    // compressed sparse weights
+    sparse = 1<<24,
 
     // real types
     ref_any             = ref  | any,
+    ref_sparse          = ref  | sparse,
 
     gemm_any            = gemm | any,
     gemm_blas           = gemm | blas,
@@ -4,14 +4,48 @@
 
 #include "convert_matmul_to_fc.hpp"
 #include "op/fully_connected.hpp"
+#include <functional>
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 
+namespace {
+
+bool is_elementwise_decompression(const std::shared_ptr<ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Multiply>(node) ||
+           ngraph::is_type<ngraph::opset1::Subtract>(node) ||
+           ngraph::is_type<ngraph::opset1::Add>(node);
+}
+
+// Index of the decompressed weights input of the elementwise operation, the other one is the broadcasted constant
+size_t get_data_input_idx(const std::shared_ptr<ngraph::Node>& node) {
+    return !ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+           ngraph::shape_size(node->get_input_shape(1)) > ngraph::shape_size(node->get_input_shape(0)) ? 1 : 0;
+}
+
+/*
+ *  Checks that the weights are decompressed on the fly (see MarkWeightsDecompression):
+ *  Constant -> Convert -> [Subtract|Add|Multiply by the Constant]*
+ */
+bool is_decompression_subgraph(const ngraph::Output<ngraph::Node>& weights) {
+    auto node = weights.get_node_shared_ptr();
+    while (is_elementwise_decompression(node)) {
+        const auto data_idx = get_data_input_idx(node);
+        if (!ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1 - data_idx)))
+            return false;
+        node = node->get_input_node_shared_ptr(data_idx);
+    }
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && ov::constant_folding_is_disabled(node) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+}
+
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -42,7 +76,9 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        // The compressed weights decompressed on the fly are supported in the 2D case only.
+        const bool decompressed_weights = rank_b == 2 && is_decompression_subgraph(fc_input_b);
+        if ((!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) && !decompressed_weights) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -131,10 +167,50 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Transferring from MatMul representation: [B, I, K] * [B, K, O] = [B, I, O]
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
+        /*
+         *  transpose_decompression function transposes the constants of the weights decompression subgraph
+         *  instead of its output, so the compressed weights are still consumed by the FullyConnected directly.
+         *  The constants broadcasted over the weights are aligned to the 2D shape beforehand.
+         */
+        std::function<ngraph::Output<ngraph::Node>(const ngraph::Output<ngraph::Node>&)> transpose_decompression;
+        transpose_decompression = [&](const ngraph::Output<ngraph::Node>& output) -> ngraph::Output<ngraph::Node> {
+            const auto node = output.get_node_shared_ptr();
+            const auto name = node->get_friendly_name() + "/transpose_b";
+            std::shared_ptr<ngraph::Node> new_node;
+            if (ngraph::is_type<ngraph::opset1::Convert>(node)) {
+                auto weights = create_transpose(node->input_value(0), name);
+                new_node = node->clone_with_new_inputs({weights});
+                ov::disable_constant_folding(new_node);
+                new_ops.push_back(weights);
+            } else {
+                const auto data_idx = get_data_input_idx(node);
+                auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1 - data_idx));
+                std::shared_ptr<ngraph::Node> new_constant = constant;
+                if (ngraph::shape_size(constant->get_shape()) > 1) {
+                    auto shape = constant->get_shape();
+                    while (shape.size() < 2)
+                        shape.insert(shape.begin(), 1);
+                    new_constant = create_transpose(std::make_shared<ngraph::opset1::Constant>(*constant, shape), name);
+                    new_ops.push_back(new_constant);
+                }
+                ngraph::OutputVector inputs(2);
+                inputs[data_idx] = transpose_decompression(node->input_value(data_idx));
+                inputs[1 - data_idx] = new_constant;
+                new_node = node->clone_with_new_inputs(inputs);
+            }
+            new_node->set_friendly_name(node->get_friendly_name());
+            new_ops.push_back(new_node);
+            return new_node;
+        };
+
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
-            new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            if (decompressed_weights) {
+                fc_input_b = transpose_decompression(fc_input_b);
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
         }
 
         if (rank_b != 2) {
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
+
+namespace {
+
+bool isConstant(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    // the zero points are usually stored compressed as well
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ngraph::is_type<ngraph::opset1::Constant>(node);
+}
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+}   // namespace
+
+ov::intel_cpu::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto& activations = pattern_map.at(activations_m);
+        const auto rank = activations.get_partial_shape().rank().get_length();
+        if (rank < 2 || rank > 3 || activations.get_element_type() != ngraph::element::f32)
+            return false;
+
+        // every weight is used by each of the rows, so the loading of the weights dominates for a few rows only
+        const auto& activationsShape = activations.get_partial_shape();
+        size_t rows = 1;
+        bool staticRows = true;
+        for (size_t i = 0; i < static_cast<size_t>(rank) - 1; i++) {
+            staticRows = staticRows && activationsShape[i].is_static();
+            if (staticRows)
+                rows *= activationsShape[i].get_length();
+        }
+        if (staticRows && rows > MarkWeightsDecompression::maxRows)
+            return false;
+
+        // skip the elementwise decompression operations up to the Convert
+        auto node = pattern_map.at(weights_m).get_node_shared_ptr();
+        while (ngraph::is_type<ngraph::opset1::Multiply>(node) ||
+               ngraph::is_type<ngraph::opset1::Subtract>(node) ||
+               ngraph::is_type<ngraph::opset1::Add>(node)) {
+            // the scales and shifts are broadcasted to the weights shape
+            const size_t dataIdx = !ngraph::is_type<ngraph::opset1::Subtract>(node) &&
+                                   ngraph::shape_size(node->get_input_shape(1)) > ngraph::shape_size(node->get_input_shape(0)) ? 1 : 0;
+            if (!hasSingleConsumer(node) || !isConstant(node->input_value(1 - dataIdx)))
+                return false;
+            node = node->get_input_node_shared_ptr(dataIdx);
+        }
+
+        auto convert = std::dynamic_pointer_cast<ngraph::opset1::Convert>(node);
+        if (!convert || !hasSingleConsumer(convert) || convert->get_destination_type() != ngraph::element::f32)
+            return false;
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!weights || weights->get_shape().size() != 2)
+            return false;
+        const auto precision = weights->get_element_type();
+        if (precision != ngraph::element::f16 && precision != ngraph::element::u8 && precision != ngraph::element::i8)
+            return false;
+
+        ov::disable_constant_folding(convert);
+        ov::enable_keep_const_precision(weights);
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
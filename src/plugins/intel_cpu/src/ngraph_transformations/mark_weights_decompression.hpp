@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Keeps the compressed weights of MatMul operations in the original precision.
+ * The pattern Constant(f16|u8|i8) -> Convert(f32) -> [Subtract|Add|Multiply by the constants]* -> MatMul
+ * is protected from the constant folding and the precision conversion, so the FullyConnected node
+ * decompresses the weights on the fly instead of keeping the expanded f32 copy.
+ * Only the memory bound MatMuls are marked: the number of the activations rows is unknown at compile time
+ * or does not exceed maxRows, the larger ones are faster with oneDNN on the f32 weights.
+ */
+class MarkWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkWeightsDecompression", "0");
+    MarkWeightsDecompression();
+
+    static constexpr size_t maxRows = 32;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -54,6 +54,9 @@ ov::intel_cpu::ReshapeFullyConnectedFusion::ReshapeFullyConnectedFusion() {
         }
 
         if (newWeightsShape != weightInput.get_shape()) {
+            // the weights decompressed on the fly by FullyConnected are kept 2D
+            if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(weightInput.get_node_shared_ptr()))
+                return false;
             auto newShape = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{newWeightsShape.size()}, newWeightsShape);
             weightInput = std::make_shared<ngraph::opset1::Reshape>(weightInput, newShape, true);
             new_ops.push_back(weightInput.get_node_shared_ptr());
@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/general_utils.h>
 #include <utils/cpu_utils.hpp>
+#include <unordered_set>
 
 using namespace ngraph;
 
@@ -134,8 +135,9 @@ bool isSuitableBinaryConvolutionParent(const std::shared_ptr<const Node> &node)
     return is_suitable_node && has_only_child;
 }
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
+    // MVN over the innermost axis is tokenized by snippets along with the surrounding eltwise operations
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
-                                  ov::is_type<ngraph::op::v6::MVN>(node) ||
+                                  (ov::is_type<ngraph::op::v6::MVN>(node) && !snippets::pass::AppropriateForSubgraph(node)) ||
                                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
                                   ov::is_type<ngraph::op::v0::Interpolate>(node) ||
                                   ov::is_type<ngraph::op::v4::Interpolate>(node) ||
@@ -297,9 +299,22 @@ void MarkSubgraphOpAsSkipped(const std::shared_ptr<Node> &node) {
 } // namespace
 
 bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
+    // The nodes computed from the constants only (e.g. the weights decompression protected from the constant folding)
+    // are executed once by the plugin, so there is no point to tokenize them
+    std::unordered_set<const Node*> constPath;
     for (auto &node : m->get_ordered_ops()) {
-        if (ngraph::op::is_constant(node))
+        if (ngraph::op::is_constant(node)) {
+            constPath.insert(node.get());
             continue;
+        }
+        const auto inputs = node->input_values();
+        if (!inputs.empty() && std::all_of(inputs.begin(), inputs.end(), [&](const Output<Node>& input) {
+                return constPath.count(input.get_node()) != 0;
+            })) {
+            constPath.insert(node.get());
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            continue;
+        }
         if (ngraph::op::is_parameter(node)) {
             SetNodeFusingType(node, NodeFusingType::IgnoredAfterInputs);
             continue;
@@ -13,6 +13,7 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <cstring>
 #include <unordered_map>
 
 #include "nodes/concat.h"
@@ -515,9 +516,13 @@ void Node::execute(mkldnn::stream strm) {
     }
 }
 
-void Node::executeDynamic(mkldnn::stream strm) {
+void Node::executeDynamic(mkldnn::stream strm, ShapeInferRecord* shapeInferRecord) {
     if (needShapeInfer()) {
-        redefineOutputMemory(shapeInfer());
+        if (shapeInferRecord) {
+            redefineOutputMemory(shapeInferRecorded(*shapeInferRecord));
+        } else {
+            redefineOutputMemory(shapeInfer());
+        }
     }
     if (isExecutable()) {
         if (needPrepareParams()) {
@@ -1464,6 +1469,9 @@ std::vector<VectorDims> Node::shapeInfer() const {
 
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                                 uint32_t input_value_port_mask) const {
+    shapeInferGenericCalled = true;
+    shapeInferValuePortMask = input_value_port_mask;
+
     // collect input values
     std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
     if (input_value_port_mask) {
@@ -1526,6 +1534,52 @@ std::vector<VectorDims> Node::shapeInferGeneric(uint32_t input_value_port_mask)
     return shapeInferGeneric(input_shapes, input_value_port_mask);
 }
 
+const std::vector<VectorDims>& Node::shapeInferRecorded(ShapeInferRecord& record) const {
+    // the values of the shape-like inputs only are worth to be recorded
+    constexpr size_t maxRecordedValuesSize = 1024;
+
+    const size_t inputsNum = getParentEdges().size();
+    auto isValuePort = [](uint32_t mask, size_t port) {
+        return port < 32 && (mask & (1u << port));
+    };
+
+    if (record.valid && record.inputDims.size() == inputsNum) {
+        bool match = true;
+        size_t offset = 0;
+        for (size_t port = 0; port < inputsNum && match; port++) {
+            const auto& mem = getParentEdgesAtPort(port)[0]->getMemory();
+            match = record.inputDims[port] == mem.getStaticDims();
+            if (match && isValuePort(record.valuePortMask, port)) {
+                const size_t size = mem.GetSize();
+                match = offset + size <= record.values.size() &&
+                        (size == 0 || std::memcmp(record.values.data() + offset, mem.GetPtr(), size) == 0);
+                offset += size;
+            }
+        }
+        if (match)
+            return record.outputDims;
+    }
+
+    shapeInferGenericCalled = false;
+    record.outputDims = shapeInfer();
+    record.valid = shapeInferGenericCalled;
+    if (record.valid) {
+        record.inputDims.resize(inputsNum);
+        record.valuePortMask = shapeInferValuePortMask;
+        record.values.clear();
+        for (size_t port = 0; port < inputsNum; port++) {
+            const auto& mem = getParentEdgesAtPort(port)[0]->getMemory();
+            record.inputDims[port] = mem.getStaticDims();
+            if (isValuePort(record.valuePortMask, port)) {
+                const auto data = static_cast<const uint8_t*>(mem.GetPtr());
+                record.values.insert(record.values.end(), data, data + mem.GetSize());
+            }
+        }
+        record.valid = record.values.size() <= maxRecordedValuesSize;
+    }
+    return record.outputDims;
+}
+
 void Node::updateLastInputDims() {
     if (lastInputDims.size() != getParentEdges().size()) {
         if (!lastInputDims.empty())
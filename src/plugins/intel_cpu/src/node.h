@@ -94,6 +94,23 @@ private:
     impl_desc_type implementationType;
 };
 
+/**
+ * @brief The node shape inference result recorded for the input shape signature of the graph, so the repeated
+ * signature reuses the output shapes instead of the shape inference, see Graph::Infer.
+ * Only the shape inference is skipped: when the input dims differ from the previous inference, the output memory
+ * descriptors are still redefined and prepareParams is still called (getting the executors from the runtime cache).
+ * When the input dims are the same as the previous inference, none of them runs, as for any dynamic node.
+ * The record is valid only for the shape inference done by Node::shapeInferGeneric, i.e. for the output shapes
+ * depending on the input dims and the values of the input ports from the value port mask only.
+ */
+struct ShapeInferRecord {
+    bool valid = false;
+    std::vector<VectorDims> inputDims;
+    uint32_t valuePortMask = 0;
+    std::vector<uint8_t> values;
+    std::vector<VectorDims> outputDims;
+};
+
 class Node {
 public:
     Node(const Node &) = delete;
@@ -330,7 +347,7 @@ public:
     void resolveInPlaceEdges();
 
     virtual void execute(mkldnn::stream strm);
-    void executeDynamic(mkldnn::stream strm);
+    void executeDynamic(mkldnn::stream strm, ShapeInferRecord* shapeInferRecord = nullptr);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
     virtual void initSupportedPrimitiveDescriptors();
@@ -571,6 +588,10 @@ public:
         rtParamsCache = cache;
     }
 
+    void setSharedRuntimeCache(MultiCachePtr cache) {
+        sharedRtParamsCache = cache;
+    }
+
 protected:
     bool canFuseSimpleOperation(const NodePtr& node) const;
 
@@ -724,6 +745,7 @@ protected:
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims, uint32_t value_port_mask = 0) const;
     std::vector<VectorDims> shapeInferGeneric(uint32_t value_port_mask = 0) const;
     virtual std::vector<VectorDims> shapeInfer() const;
+    const std::vector<VectorDims>& shapeInferRecorded(ShapeInferRecord& record) const;
     // TODO [DS] : make pure after all nodes will be support dynamic shapes
     virtual void executeDynamicImpl(mkldnn::stream strm) {
         IE_THROW(NotImplemented) << "[DS] executeDynamicImpl not implemented for node with type: " << getTypeStr();
@@ -740,6 +762,12 @@ protected:
         return rtParamsCache;
     }
 
+    // the cache shared by the graphs of all the streams (the graph own cache if not set), only for the values
+    // that keep no mutable state between the executions (e.g. the generated code), unlike the executors
+    MultiCachePtr getSharedRuntimeCache() const {
+        return sharedRtParamsCache ? sharedRtParamsCache : rtParamsCache;
+    }
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
@@ -766,6 +794,11 @@ private:
     PerfCounters profiling;
 
     MultiCachePtr rtParamsCache;
+    MultiCachePtr sharedRtParamsCache;
+
+    // set by shapeInferGeneric to tell shapeInferRecorded whether (and which input values) the shape inference used
+    mutable bool shapeInferGenericCalled = false;
+    mutable uint32_t shapeInferValuePortMask = 0;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
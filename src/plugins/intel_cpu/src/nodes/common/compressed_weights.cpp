@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compressed_weights.h"
+#include "fp16_utils.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the rows of src processed during a single pass over the row of the weights,
+// so the conversion of the weights is shared between them
+constexpr size_t rowsBlock = 8;
+// the weights are converted by the blocks fitting L1 together with the rows of src
+constexpr size_t kBlock = 256;
+// the independent partial sums, so the dot product is vectorized
+constexpr size_t lanes = 8;
+
+template <typename T>
+inline float toFloat(T value) {
+    return static_cast<float>(value);
+}
+
+template <>
+inline float toFloat<ie_fp16>(ie_fp16 value) {
+    return f16tof32(value);
+}
+
+}   // namespace
+
+CompressedWeights::CompressedWeights(const void* weights, Precision precision, size_t N, size_t K,
+                                     std::vector<float> scales, std::vector<float> shifts)
+        : weights(weights), precision(precision), N(N), K(K), scales(std::move(scales)), shifts(std::move(shifts)) {
+    if (!isSupportedPrecision(precision))
+        IE_THROW() << "CompressedWeights doesn't support " << precision << " weights";
+    if (this->scales.size() != N || this->shifts.size() != N)
+        IE_THROW() << "CompressedWeights has incorrect size of the decompression parameters";
+}
+
+bool CompressedWeights::isSupportedPrecision(Precision precision) {
+    return precision == Precision::U8 || precision == Precision::I8 || precision == Precision::FP16;
+}
+
+void CompressedWeights::execute(const float* src, const float* bias, float* dst, size_t M) const {
+    switch (precision) {
+        case Precision::U8:
+            executeImpl(static_cast<const uint8_t*>(weights), src, bias, dst, M);
+            break;
+        case Precision::I8:
+            executeImpl(static_cast<const int8_t*>(weights), src, bias, dst, M);
+            break;
+        case Precision::FP16:
+            executeImpl(static_cast<const ie_fp16*>(weights), src, bias, dst, M);
+            break;
+        default:
+            IE_THROW() << "CompressedWeights doesn't support " << precision << " weights";
+    }
+}
+
+template <typename T>
+void CompressedWeights::executeImpl(const T* weights, const float* src, const float* bias, float* dst, size_t M) const {
+    parallel_for(N, [&](size_t n) {
+        const T* row = weights + n * K;
+        const float scale = scales[n];
+        const float shift = shifts[n];
+        const float b = bias ? bias[n] : 0.f;
+        float w[kBlock];
+
+        for (size_t m0 = 0; m0 < M; m0 += rowsBlock) {
+            const size_t rows = std::min(rowsBlock, M - m0);
+            float acc[rowsBlock][lanes] = {};
+
+            for (size_t k0 = 0; k0 < K; k0 += kBlock) {
+                const size_t len = std::min(kBlock, K - k0);
+                for (size_t k = 0; k < len; k++)
+                    w[k] = toFloat(row[k0 + k]) * scale + shift;
+
+                for (size_t m = 0; m < rows; m++) {
+                    const float* x = src + (m0 + m) * K + k0;
+                    float* a = acc[m];
+                    size_t k = 0;
+                    for (; k + lanes <= len; k += lanes) {
+                        for (size_t l = 0; l < lanes; l++)
+                            a[l] += x[k + l] * w[k + l];
+                    }
+                    for (; k < len; k++)
+                        a[0] += x[k] * w[k];
+                }
+            }
+
+            for (size_t m = 0; m < rows; m++) {
+                float dot = 0.f;
+                for (size_t l = 0; l < lanes; l++)
+                    dot += acc[m][l];
+                dst[(m0 + m) * N + n] = dot + b;
+            }
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
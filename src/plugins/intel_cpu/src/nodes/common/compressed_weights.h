@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Compressed weights of the FullyConnected layer and the matrix multiplication on top of them.
+ * The [N, K] weights are kept in u8, i8 or f16 precision and the f32 weights are w[n, k] * scales[n] + shifts[n].
+ * The weights are decompressed by the short blocks right before the multiplication, so the expanded f32 copy
+ * is never stored and only the compressed weights are loaded from the memory. The accumulation is done in f32.
+ */
+class CompressedWeights {
+public:
+    /**
+     * @param weights the weights of [N, K] shape, the memory isn't copied and must outlive the object
+     * @param scales, shifts the decompression parameters of N size
+     */
+    CompressedWeights(const void* weights, InferenceEngine::Precision precision, size_t N, size_t K,
+                      std::vector<float> scales, std::vector<float> shifts);
+
+    /**
+     * @brief Computes dst[M, N] = src[M, K] * decompressed_weights^T + bias[N]
+     * @param bias may be nullptr
+     */
+    void execute(const float* src, const float* bias, float* dst, size_t M) const;
+
+    static bool isSupportedPrecision(InferenceEngine::Precision precision);
+
+private:
+    template <typename T>
+    void executeImpl(const T* weights, const float* src, const float* bias, float* dst, size_t M) const;
+
+    const void* weights;
+    InferenceEngine::Precision precision;
+    size_t N;
+    size_t K;
+    std::vector<float> scales;
+    std::vector<float> shifts;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,405 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+
+#include "cpu_memcpy.h"
+#include "ie_parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+constexpr double PI = 3.141592653589793238462643;
+
+// radices of the stages from the first one, empty if the length has other prime factors
+std::vector<size_t> factorize(size_t length) {
+    std::vector<size_t> radices;
+    for (size_t radix : {4, 2, 3, 5}) {
+        while (length % radix == 0) {
+            radices.push_back(radix);
+            length /= radix;
+        }
+    }
+    return length == 1 ? radices : std::vector<size_t>{};
+}
+
+size_t nextSmoothLength(size_t length) {
+    while (factorize(length).empty())
+        length++;
+    return length;
+}
+
+/*
+    Returns the offset of the 1D signal along the axis, the signals are numbered over all other dimensions
+    except the last one holding the real and imaginary parts
+*/
+size_t signalOffset(size_t signal, size_t axis, const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
+    size_t offset = 0;
+    for (size_t dim = shape.size() - 1; dim-- > 0;) {
+        if (dim == axis)
+            continue;
+        offset += (signal % shape[dim]) * strides[dim];
+        signal /= shape[dim];
+    }
+    return offset;
+}
+
+void gatherToBuffer(float* buffer, const float* data, size_t numberOfComplex, size_t stride) {
+    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
+        buffer[bufferIndex] = data[0];
+        buffer[bufferIndex + 1] = data[1];
+        data += stride;
+    }
+}
+
+void applyBuffer(const float* buffer, float* output, size_t numberOfComplex, size_t stride) {
+    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
+        output[0] = buffer[bufferIndex];
+        output[1] = buffer[bufferIndex + 1];
+        output += stride;
+    }
+}
+
+}   // namespace
+
+FFTPlan::FFTPlan(size_t length, bool inverse) : length(length), inverse(inverse) {
+    if (length <= 1)
+        return;
+
+    const double sign = inverse ? 1.0 : -1.0;
+    const auto radices = factorize(length);
+    if (radices.empty()) {
+        // X[k] = c[k] * sum(x[n] * c[n] * conj(c[k - n])), c[n] = exp(-i * pi * n^2 / N)
+        const size_t convolutionLength = nextSmoothLength(2 * length - 1);
+        convolutionPlan.reset(new FFTPlan(convolutionLength, false));
+
+        chirp.resize(length);
+        for (size_t n = 0; n < length; n++) {
+            // n^2 mod 2N keeps the angle small for the long signals
+            const double angle = sign * PI * static_cast<double>((n * n) % (2 * length)) / length;
+            chirp[n] = {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+        }
+
+        chirpSpectrum.assign(convolutionLength, {0.f, 0.f});
+        for (size_t n = 0; n < length; n++) {
+            const Complex conjugated = {chirp[n].re, -chirp[n].im};
+            chirpSpectrum[n] = conjugated;
+            if (n != 0)
+                chirpSpectrum[convolutionLength - n] = conjugated;
+        }
+        std::vector<float> scratch(convolutionPlan->getScratchSize());
+        convolutionPlan->execute(reinterpret_cast<float*>(chirpSpectrum.data()), scratch.data());
+        // the normalization of the inverse transform of the convolution
+        for (auto& value : chirpSpectrum) {
+            value.re /= convolutionLength;
+            value.im /= convolutionLength;
+        }
+        return;
+    }
+
+    size_t stageLength = length;
+    for (size_t radix : radices) {
+        Stage stage;
+        stage.radix = radix;
+        const size_t butterflies = stageLength / radix;
+        stage.twiddles.resize(butterflies * (radix - 1));
+        for (size_t p = 0; p < butterflies; p++) {
+            for (size_t k = 1; k < radix; k++) {
+                const double angle = sign * 2.0 * PI * static_cast<double>(p * k) / stageLength;
+                stage.twiddles[p * (radix - 1) + k - 1] = {static_cast<float>(std::cos(angle)),
+                                                           static_cast<float>(std::sin(angle))};
+            }
+        }
+        stages.push_back(std::move(stage));
+        stageLength /= radix;
+    }
+}
+
+size_t FFTPlan::getScratchSize() const {
+    if (convolutionPlan)
+        return 2 * chirpSpectrum.size() + convolutionPlan->getScratchSize();
+    return 2 * length;
+}
+
+void FFTPlan::execute(float* data, float* scratch) const {
+    auto* values = reinterpret_cast<Complex*>(data);
+    if (convolutionPlan) {
+        executeBluestein(values, reinterpret_cast<Complex*>(scratch));
+    } else {
+        executeStages(values, reinterpret_cast<Complex*>(scratch));
+    }
+
+    if (inverse) {
+        const float scale = 1.f / length;
+        for (size_t i = 0; i < 2 * length; i++)
+            data[i] *= scale;
+    }
+}
+
+void FFTPlan::executeStages(Complex* data, Complex* buffer) const {
+    const Complex* src = data;
+    Complex* dst = buffer;
+    size_t stageLength = length;
+    size_t stride = 1;
+    for (const auto& stage : stages) {
+        switch (stage.radix) {
+        case 2: executeStage<2>(stage, stageLength, stride, src, dst); break;
+        case 3: executeStage<3>(stage, stageLength, stride, src, dst); break;
+        case 4: executeStage<4>(stage, stageLength, stride, src, dst); break;
+        case 5: executeStage<5>(stage, stageLength, stride, src, dst); break;
+        }
+        stageLength /= stage.radix;
+        stride *= stage.radix;
+        src = dst;
+        dst = dst == buffer ? data : buffer;
+    }
+    if (src != data)
+        cpu_memcpy(data, src, length * sizeof(Complex));
+}
+
+/*
+ * A stage splits each of the stride interleaved sequences of the given length into radix subsequences of
+ * length / radix elements with the decimation in frequency. The element j of the sequence q is src[q + stride * j].
+ */
+template <size_t radix>
+void FFTPlan::executeStage(const Stage& stage, size_t length, size_t stride, const Complex* src, Complex* dst) const {
+    const size_t butterflies = length / radix;
+    // multiplication by -i for the forward transform and by i for the inverse one
+    const float rot = inverse ? -1.f : 1.f;
+    auto rotate = [rot](float re, float im) -> Complex {
+        return {rot * im, -rot * re};
+    };
+
+    for (size_t p = 0; p < butterflies; p++) {
+        const Complex* w = &stage.twiddles[p * (radix - 1)];
+        const Complex* in = src + stride * p;
+        Complex* out = dst + stride * radix * p;
+
+        for (size_t q = 0; q < stride; q++) {
+            Complex a[radix];
+            for (size_t j = 0; j < radix; j++)
+                a[j] = in[q + stride * butterflies * j];
+
+            Complex b[radix];
+            if (radix == 2) {
+                b[0] = {a[0].re + a[1].re, a[0].im + a[1].im};
+                b[1] = {a[0].re - a[1].re, a[0].im - a[1].im};
+            } else if (radix == 3) {
+                constexpr float c = -0.5f;
+                constexpr float s = 0.866025403784438646763723f;
+                const Complex t = {a[1].re + a[2].re, a[1].im + a[2].im};
+                const Complex d = rotate(s * (a[1].re - a[2].re), s * (a[1].im - a[2].im));
+                const Complex m = {a[0].re + c * t.re, a[0].im + c * t.im};
+                b[0] = {a[0].re + t.re, a[0].im + t.im};
+                b[1] = {m.re + d.re, m.im + d.im};
+                b[2] = {m.re - d.re, m.im - d.im};
+            } else if (radix == 4) {
+                const Complex t0 = {a[0].re + a[2].re, a[0].im + a[2].im};
+                const Complex t1 = {a[0].re - a[2].re, a[0].im - a[2].im};
+                const Complex t2 = {a[1].re + a[3].re, a[1].im + a[3].im};
+                const Complex t3 = rotate(a[1].re - a[3].re, a[1].im - a[3].im);
+                b[0] = {t0.re + t2.re, t0.im + t2.im};
+                b[1] = {t1.re + t3.re, t1.im + t3.im};
+                b[2] = {t0.re - t2.re, t0.im - t2.im};
+                b[3] = {t1.re - t3.re, t1.im - t3.im};
+            } else if (radix == 5) {
+                constexpr float c1 = 0.309016994374947424102293f;
+                constexpr float c2 = -0.809016994374947424102293f;
+                constexpr float s1 = 0.951056516295153572116439f;
+                constexpr float s2 = 0.587785252292473129168706f;
+                const Complex t1 = {a[1].re + a[4].re, a[1].im + a[4].im};
+                const Complex t2 = {a[2].re + a[3].re, a[2].im + a[3].im};
+                const Complex d1 = {a[1].re - a[4].re, a[1].im - a[4].im};
+                const Complex d2 = {a[2].re - a[3].re, a[2].im - a[3].im};
+                const Complex m1 = {a[0].re + c1 * t1.re + c2 * t2.re, a[0].im + c1 * t1.im + c2 * t2.im};
+                const Complex m2 = {a[0].re + c2 * t1.re + c1 * t2.re, a[0].im + c2 * t1.im + c1 * t2.im};
+                const Complex r1 = rotate(s1 * d1.re + s2 * d2.re, s1 * d1.im + s2 * d2.im);
+                const Complex r2 = rotate(s2 * d1.re - s1 * d2.re, s2 * d1.im - s1 * d2.im);
+                b[0] = {a[0].re + t1.re + t2.re, a[0].im + t1.im + t2.im};
+                b[1] = {m1.re + r1.re, m1.im + r1.im};
+                b[2] = {m2.re + r2.re, m2.im + r2.im};
+                b[3] = {m2.re - r2.re, m2.im - r2.im};
+                b[4] = {m1.re - r1.re, m1.im - r1.im};
+            }
+
+            out[q] = b[0];
+            for (size_t k = 1; k < radix; k++) {
+                const Complex& tw = w[k - 1];
+                out[q + stride * k] = {b[k].re * tw.re - b[k].im * tw.im, b[k].re * tw.im + b[k].im * tw.re};
+            }
+        }
+    }
+}
+
+void FFTPlan::executeBluestein(Complex* data, Complex* scratch) const {
+    const size_t convolutionLength = chirpSpectrum.size();
+    Complex* work = scratch;
+    float* convolutionScratch = reinterpret_cast<float*>(scratch + convolutionLength);
+
+    for (size_t n = 0; n < length; n++) {
+        work[n] = {data[n].re * chirp[n].re - data[n].im * chirp[n].im,
+                   data[n].re * chirp[n].im + data[n].im * chirp[n].re};
+    }
+    std::fill(work + length, work + convolutionLength, Complex{0.f, 0.f});
+
+    convolutionPlan->execute(reinterpret_cast<float*>(work), convolutionScratch);
+    // the product of the spectra is conjugated to get the inverse transform from the forward one
+    for (size_t k = 0; k < convolutionLength; k++) {
+        const Complex& s = chirpSpectrum[k];
+        work[k] = {work[k].re * s.re - work[k].im * s.im, -(work[k].re * s.im + work[k].im * s.re)};
+    }
+    convolutionPlan->execute(reinterpret_cast<float*>(work), convolutionScratch);
+
+    for (size_t k = 0; k < length; k++) {
+        const Complex value = {work[k].re, -work[k].im};
+        data[k] = {value.re * chirp[k].re - value.im * chirp[k].im, value.re * chirp[k].im + value.im * chirp[k].re};
+    }
+}
+
+RealFFTPlan::RealFFTPlan(size_t length, bool inverse) : length(length), inverse(inverse) {
+    if (length % 2 != 0) {
+        complexPlan.reset(new FFTPlan(length, inverse));
+        return;
+    }
+
+    complexPlan.reset(new FFTPlan(length / 2, inverse));
+    twiddles.resize(length / 2 * 2 + 2);
+    for (size_t k = 0; k <= length / 2; k++) {
+        const double angle = -2.0 * PI * static_cast<double>(k) / length;
+        twiddles[2 * k] = static_cast<float>(std::cos(angle));
+        twiddles[2 * k + 1] = static_cast<float>(std::sin(angle));
+    }
+}
+
+size_t RealFFTPlan::getScratchSize() const {
+    if (length % 2 != 0)
+        return 2 * length + complexPlan->getScratchSize();
+    return complexPlan->getScratchSize();
+}
+
+void RealFFTPlan::execute(const float* src, float* dst, float* scratch) const {
+    if (inverse) {
+        executeInverse(src, dst, scratch);
+    } else {
+        executeForward(src, dst, scratch);
+    }
+}
+
+void RealFFTPlan::executeForward(const float* src, float* dst, float* scratch) const {
+    const size_t half = length / 2;
+    if (length % 2 != 0) {
+        float* signal = scratch;
+        for (size_t n = 0; n < length; n++) {
+            signal[2 * n] = src[n];
+            signal[2 * n + 1] = 0.f;
+        }
+        complexPlan->execute(signal, scratch + 2 * length);
+        cpu_memcpy(dst, signal, 2 * (half + 1) * sizeof(float));
+        return;
+    }
+
+    // z[n] = x[2n] + i * x[2n + 1] is the real signal itself read as the interleaved complex values
+    cpu_memcpy(dst, src, length * sizeof(float));
+    complexPlan->execute(dst, scratch);
+
+    // X[k] = E[k] + W^k * O[k], E[k] = (Z[k] + conj(Z[half - k])) / 2, O[k] = -i * (Z[k] - conj(Z[half - k])) / 2
+    // and the values for k and half - k are computed together as E[half - k] = conj(E[k]), O[half - k] = conj(O[k])
+    const float z0re = dst[0];
+    const float z0im = dst[1];
+    dst[0] = z0re + z0im;
+    dst[1] = 0.f;
+    dst[2 * half] = z0re - z0im;
+    dst[2 * half + 1] = 0.f;
+    for (size_t k = 1; k <= half / 2; k++) {
+        const size_t j = half - k;
+        const float are = dst[2 * k], aim = dst[2 * k + 1];
+        const float bre = dst[2 * j], bim = dst[2 * j + 1];
+        const float ere = 0.5f * (are + bre), eim = 0.5f * (aim - bim);
+        const float ore = 0.5f * (aim + bim), oim = -0.5f * (are - bre);
+        const float wkre = twiddles[2 * k], wkim = twiddles[2 * k + 1];
+        const float wjre = twiddles[2 * j], wjim = twiddles[2 * j + 1];
+        dst[2 * k] = ere + wkre * ore - wkim * oim;
+        dst[2 * k + 1] = eim + wkre * oim + wkim * ore;
+        dst[2 * j] = ere + wjre * ore + wjim * oim;
+        dst[2 * j + 1] = -eim - wjre * oim + wjim * ore;
+    }
+}
+
+void RealFFTPlan::executeInverse(const float* src, float* dst, float* scratch) const {
+    const size_t half = length / 2;
+    if (length % 2 != 0) {
+        float* spectrum = scratch;
+        spectrum[0] = src[0];
+        spectrum[1] = 0.f;
+        for (size_t k = 1; k <= half; k++) {
+            spectrum[2 * k] = src[2 * k];
+            spectrum[2 * k + 1] = src[2 * k + 1];
+            spectrum[2 * (length - k)] = src[2 * k];
+            spectrum[2 * (length - k) + 1] = -src[2 * k + 1];
+        }
+        complexPlan->execute(spectrum, scratch + 2 * length);
+        for (size_t n = 0; n < length; n++)
+            dst[n] = spectrum[2 * n];
+        return;
+    }
+
+    // Z[k] = E[k] + i * O[k], E[k] = (X[k] + conj(X[half - k])) / 2, O[k] = (X[k] - conj(X[half - k])) / (2 * W^k),
+    // the imaginary parts of X[0] and X[half] are dropped
+    for (size_t k = 0; k < half; k++) {
+        const size_t j = half - k;
+        const float are = src[2 * k], aim = k == 0 ? 0.f : src[2 * k + 1];
+        const float bre = src[2 * j], bim = j == half ? 0.f : src[2 * j + 1];
+        const float ere = 0.5f * (are + bre), eim = 0.5f * (aim - bim);
+        const float dre = 0.5f * (are - bre), dim = 0.5f * (aim + bim);
+        // division by W^k is the multiplication by its conjugate
+        const float wre = twiddles[2 * k], wim = twiddles[2 * k + 1];
+        const float ore = dre * wre + dim * wim, oim = dim * wre - dre * wim;
+        dst[2 * k] = ere - oim;
+        dst[2 * k + 1] = eim + ore;
+    }
+    // x[2n] = Re(z[n]), x[2n + 1] = Im(z[n]) is the interleaved layout of the complex result
+    complexPlan->execute(dst, scratch);
+}
+
+void fftAlongAxis(const FFTPlan& plan, float* data, const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                  size_t axis) {
+    const size_t totalComplex = std::accumulate(shape.begin(), shape.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t signalLength = shape[axis];
+    if (totalComplex == 0)
+        return;
+    const size_t signalsNumber = totalComplex / signalLength;
+    const size_t axisStride = strides[axis];
+    // the signals along the innermost axis are transformed in place
+    const bool isContiguous = axisStride == 2;
+
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(signalsNumber, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> scratch(plan.getScratchSize() + (isContiguous ? 0 : 2 * signalLength));
+        float* gatheredData = scratch.data() + plan.getScratchSize();
+        for (size_t signal = start; signal < end; ++signal) {
+            float* signalData = data + signalOffset(signal, axis, shape, strides);
+            if (isContiguous) {
+                plan.execute(signalData, scratch.data());
+            } else {
+                gatherToBuffer(gatheredData, signalData, signalLength, axisStride);
+                plan.execute(gatheredData, scratch.data());
+                applyBuffer(gatheredData, signalData, signalLength, axisStride);
+            }
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
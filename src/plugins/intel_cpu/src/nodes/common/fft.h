@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Precomputed 1D complex FFT of the fixed length and direction.
+ * The length is factorized into the radix 4, 2, 3 and 5 stages of the Stockham autosort algorithm, so no bit reversal
+ * is needed and the innermost loop of every stage runs over the contiguous elements. The twiddle factors of all the
+ * stages are computed once at construction. The lengths with a prime factor greater than 5 are computed by the Bluestein
+ * algorithm as a convolution with a chirp on top of the FFT of a 5-smooth length not less than 2 * length - 1.
+ * The inverse transform is normalized by 1 / length.
+ */
+class FFTPlan {
+public:
+    using Ptr = std::shared_ptr<FFTPlan>;
+
+    FFTPlan(size_t length, bool inverse);
+
+    /**
+     * @brief Transforms the data in place
+     * @param data length complex values as the interleaved real and imaginary parts
+     * @param scratch buffer of getScratchSize() floats, its content is not preserved
+     */
+    void execute(float* data, float* scratch) const;
+
+    size_t getScratchSize() const;
+
+private:
+    struct Complex {
+        float re;
+        float im;
+    };
+
+    struct Stage {
+        size_t radix;
+        // the twiddle factors of the stage, radix - 1 values per butterfly
+        std::vector<Complex> twiddles;
+    };
+
+    void executeStages(Complex* data, Complex* buffer) const;
+
+    template <size_t radix>
+    void executeStage(const Stage& stage, size_t length, size_t stride, const Complex* src, Complex* dst) const;
+
+    void executeBluestein(Complex* data, Complex* scratch) const;
+
+    size_t length;
+    bool inverse;
+    std::vector<Stage> stages;
+
+    // Bluestein algorithm
+    std::unique_ptr<FFTPlan> convolutionPlan;
+    std::vector<Complex> chirp;
+    std::vector<Complex> chirpSpectrum;
+};
+
+/**
+ * @brief Precomputed 1D FFT of the real signal of the fixed length, only the non-redundant half of the spectrum
+ * (length / 2 + 1 complex values) is stored because of the Hermitian symmetry. The even lengths are computed by the
+ * complex FFT of the half length: the even and odd samples are packed as the real and imaginary parts and separated
+ * by the post-processing pass. The odd lengths fall back to the complex FFT of the full length.
+ */
+class RealFFTPlan {
+public:
+    using Ptr = std::shared_ptr<RealFFTPlan>;
+
+    /**
+     * @param inverse the complex-to-real transform normalized by 1 / length if true, the real-to-complex one otherwise
+     */
+    RealFFTPlan(size_t length, bool inverse);
+
+    /**
+     * @brief Computes the transform out of place
+     * @param src length real values for the forward transform, length / 2 + 1 interleaved complex values for the
+     * inverse one, the imaginary parts of the zero and the Nyquist frequency are ignored as they are zero in the
+     * spectrum of the real signal
+     * @param dst length / 2 + 1 interleaved complex values for the forward transform, length real values for the
+     * inverse one
+     * @param scratch buffer of getScratchSize() floats, its content is not preserved
+     */
+    void execute(const float* src, float* dst, float* scratch) const;
+
+    size_t getScratchSize() const;
+
+private:
+    void executeForward(const float* src, float* dst, float* scratch) const;
+    void executeInverse(const float* src, float* dst, float* scratch) const;
+
+    size_t length;
+    bool inverse;
+    // the half length plan for the even length, the full length one otherwise
+    std::unique_ptr<FFTPlan> complexPlan;
+    // exp(-2 * pi * i * k / length) for k in [0, length / 2], the interleaved real and imaginary parts
+    std::vector<float> twiddles;
+};
+
+/**
+ * @brief Transforms all the 1D signals along the axis of the complex tensor in place, the signals are split between
+ * the threads
+ * @param plan the plan of the length shape[axis]
+ * @param shape the dims of the tensor, the last one holds the real and imaginary parts
+ * @param strides the strides of the tensor in floats
+ */
+void fftAlongAxis(const FFTPlan& plan, float* data, const std::vector<size_t>& shape, const std::vector<size_t>& strides,
+                  size_t axis);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_weights.h"
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+inline size_t lowestBit(uint64_t mask) {
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward64(&idx, mask);
+    return idx;
+#else
+    return __builtin_ctzll(mask);
+#endif
+}
+
+// the rows of src processed during a single pass over the compressed row of the weights,
+// so the decoding of the bitmasks is shared between them
+constexpr size_t rowsBlock = 8;
+
+}   // namespace
+
+size_t SparseWeights::getCompressedSize(const float* weights, size_t N, size_t K) {
+    const size_t nonZero = parallel_sum(N * K, size_t(0), [&](size_t i) -> size_t {
+        return weights[i] != 0.f ? 1 : 0;
+    });
+    return (N + 1) * sizeof(uint64_t) + N * getGroupsNum(K) * sizeof(uint64_t) + nonZero * sizeof(float);
+}
+
+void SparseWeights::compress(const float* weights, size_t N, size_t K, void* buffer) {
+    const size_t groupsNum = getGroupsNum(K);
+    auto rowOffsets = static_cast<uint64_t*>(buffer);
+    auto masks = rowOffsets + N + 1;
+    auto values = reinterpret_cast<float*>(masks + N * groupsNum);
+
+    std::fill(masks, masks + N * groupsNum, 0);
+    rowOffsets[0] = 0;
+    parallel_for(N, [&](size_t n) {
+        const float* row = weights + n * K;
+        uint64_t* rowMasks = masks + n * groupsNum;
+        size_t nonZero = 0;
+        for (size_t k = 0; k < K; k++) {
+            if (row[k] != 0.f) {
+                rowMasks[k / groupSize] |= uint64_t(1) << (k % groupSize);
+                nonZero++;
+            }
+        }
+        rowOffsets[n + 1] = nonZero;
+    });
+
+    for (size_t n = 0; n < N; n++)
+        rowOffsets[n + 1] += rowOffsets[n];
+
+    parallel_for(N, [&](size_t n) {
+        const float* row = weights + n * K;
+        std::copy_if(row, row + K, values + rowOffsets[n], [](float w) { return w != 0.f; });
+    });
+}
+
+SparseWeights::SparseWeights(const void* buffer, size_t N, size_t K)
+        : N(N), K(K), groupsNum(getGroupsNum(K)) {
+    rowOffsets = static_cast<const uint64_t*>(buffer);
+    masks = rowOffsets + N + 1;
+    values = reinterpret_cast<const float*>(masks + N * groupsNum);
+}
+
+void SparseWeights::execute(const float* src, const float* bias, float* dst, size_t M) const {
+    parallel_for(N, [&](size_t n) {
+        const uint64_t* rowMasks = masks + n * groupsNum;
+        const float* rowValues = values + rowOffsets[n];
+        const float b = bias ? bias[n] : 0.f;
+
+        if (M == 1) {
+            // a single row has no independent accumulations to hide the latency of the additions, so the non-zero
+            // weights are accumulated in turn into two sums
+            float acc0 = 0.f, acc1 = 0.f;
+            size_t idx = 0;
+            for (size_t g = 0; g < groupsNum; g++) {
+                const float* srcGroup = src + g * groupSize;
+                uint64_t mask = rowMasks[g];
+                while (mask) {
+                    acc0 += srcGroup[lowestBit(mask)] * rowValues[idx++];
+                    mask &= mask - 1;
+                    if (!mask)
+                        break;
+                    acc1 += srcGroup[lowestBit(mask)] * rowValues[idx++];
+                    mask &= mask - 1;
+                }
+            }
+            dst[n] = acc0 + acc1 + b;
+            return;
+        }
+
+        for (size_t m0 = 0; m0 < M; m0 += rowsBlock) {
+            const size_t rows = std::min(rowsBlock, M - m0);
+            const float* srcBlock = src + m0 * K;
+            float acc[rowsBlock] = {};
+
+            size_t idx = 0;
+            for (size_t g = 0; g < groupsNum; g++) {
+                uint64_t mask = rowMasks[g];
+                while (mask) {
+                    const size_t k = g * groupSize + lowestBit(mask);
+                    const float w = rowValues[idx++];
+                    for (size_t m = 0; m < rows; m++)
+                        acc[m] += srcBlock[m * K + k] * w;
+                    mask &= mask - 1;
+                }
+            }
+
+            for (size_t m = 0; m < rows; m++)
+                dst[(m0 + m) * N + n] = acc[m] + b;
+        }
+    });
+}
+
+float SparseWeights::getSparseRate(const float* data, size_t size) {
+    if (size == 0)
+        return 0.f;
+    const size_t zeros = parallel_sum(size, size_t(0), [&](size_t i) -> size_t {
+        return data[i] == 0.f ? 1 : 0;
+    });
+    return static_cast<float>(zeros) / size;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
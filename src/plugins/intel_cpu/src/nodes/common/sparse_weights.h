@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Bitmask compressed weights of the FullyConnected layer and the matrix multiplication on top of them.
+ * Each row of the [N, K] weights is split into the groups of 64 elements. Every group is represented by the bitmask
+ * of the non-zero elements, the non-zero values of the row are stored packed one after another. So only the non-zero
+ * weights are loaded from the memory and multiplied, the zero ones cost a single bit.
+ * The compressed weights are kept in a single buffer: [N + 1] offsets of the rows in the packed values,
+ * [N, groupsNum] bitmasks and the packed values. So the buffer can be shared by the streams through the weights cache,
+ * the object is a view of the buffer.
+ */
+class SparseWeights {
+public:
+    /**
+     * @brief Returns the size in bytes of the buffer for the compressed weights
+     * @param weights the plain f32 weights of [N, K] shape
+     */
+    static size_t getCompressedSize(const float* weights, size_t N, size_t K);
+
+    /**
+     * @brief Compresses the plain f32 weights of [N, K] shape into the buffer of getCompressedSize bytes
+     */
+    static void compress(const float* weights, size_t N, size_t K, void* buffer);
+
+    /**
+     * @param buffer the compressed weights, must outlive the object
+     */
+    SparseWeights(const void* buffer, size_t N, size_t K);
+
+    /**
+     * @brief Computes dst[M, N] = src[M, K] * weights^T + bias[N]
+     * @param bias may be nullptr
+     */
+    void execute(const float* src, const float* bias, float* dst, size_t M) const;
+
+    /**
+     * @brief Returns the fraction of the zero elements in the data
+     */
+    static float getSparseRate(const float* data, size_t size);
+
+private:
+    static constexpr size_t groupSize = 64;
+
+    static size_t getGroupsNum(size_t K) {
+        return (K + groupSize - 1) / groupSize;
+    }
+
+    size_t N;
+    size_t K;
+    size_t groupsNum;
+    const uint64_t* rowOffsets;
+    const uint64_t* masks;
+    const float* values;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
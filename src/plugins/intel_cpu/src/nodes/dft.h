@@ -8,6 +8,8 @@
 #include <node.h>
 #include <string>
 
+#include "common/fft.h"
+
 namespace ov {
 namespace intel_cpu {
 namespace node {
@@ -27,12 +29,9 @@ public:
 
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
-
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
 
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // the plans are cached by the signal length, so the twiddles are computed once per node
+    std::unordered_map<size_t, FFTPlan::Ptr> fftPlans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -40,7 +39,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
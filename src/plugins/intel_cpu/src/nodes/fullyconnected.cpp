@@ -5,10 +5,12 @@
 #include "fullyconnected.h"
 #include "eltwise.h"
 #include "fake_quantize.h"
+#include "input.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
 #include <dnnl_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
@@ -164,6 +166,9 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (useSparseWeights || useWeightsDecompression)
+        return;
+
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -220,6 +225,21 @@ void FullyConnected::prepareParams() {
             IE_THROW() << "Input memory hasn't been allocated.";
     }
 
+    // the weights are compressed once on the graph creation
+    if (useSparseWeights)
+        return;
+
+    if (useWeightsDecompression) {
+        if (!compressedWeights) {
+            const auto& wghDims = wghMemPtr->getStaticDims();
+            compressedWeights = std::make_shared<CompressedWeights>(wghMemPtr->GetPtr(),
+                                                                    wghMemPtr->getDesc().getPrecision(),
+                                                                    wghDims[0], wghDims[1],
+                                                                    decompressionScales, decompressionShifts);
+        }
+        return;
+    }
+
     const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
@@ -329,6 +349,11 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (useSparseWeights || useWeightsDecompression) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
+
     dynBatchLim = lim;
 
     auto setBatchPrimArgs = [this](int argType, const mkldnn::memory& oldMem) {
@@ -350,6 +375,16 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+
+    if (useWeightsDecompression) {
+        executeCompressed();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
@@ -376,7 +411,99 @@ void FullyConnected::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+void FullyConnected::executeSparse() {
+    const auto& srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    // all the dims except the innermost one are collapsed into the rows of the matrix
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (dynBatchLim > 0)
+        M = M / srcDims[0] * batchToProcess();
+
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    sparseWeights->execute(reinterpret_cast<const float*>(srcMemPtr->GetPtr()),
+                           bias,
+                           reinterpret_cast<float*>(dstMemPtr->GetPtr()),
+                           M);
+}
+
+void FullyConnected::executeCompressed() {
+    const auto& srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    const auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    if (dynBatchLim > 0)
+        M = M / srcDims[0] * batchToProcess();
+
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    compressedWeights->execute(reinterpret_cast<const float*>(srcMemPtr->GetPtr()),
+                               bias,
+                               reinterpret_cast<float*>(dstMemPtr->GetPtr()),
+                               M);
+}
+
+void FullyConnected::fuseWeightsDecompression(std::vector<float> scales, std::vector<float> shifts) {
+    useWeightsDecompression = true;
+    decompressionScales = std::move(scales);
+    decompressionShifts = std::move(shifts);
+}
+
+void FullyConnected::initSparseWeightsDecompression(float minSparseRate) {
+    useSparseWeights = false;
+    if (minSparseRate >= 1.f)
+        return;
+
+    // the sparse kernel supports only f32 FullyConnected with 2D constant weights
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 ||
+        getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        (withBiases && getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32) ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        getInputShapeAtPort(WEIGHTS_ID).getRank() != 2)
+        return;
+
+    const auto weightsNode = std::dynamic_pointer_cast<Input>(getParentEdgesAtPort(WEIGHTS_ID)[0]->getParent());
+    if (!weightsNode || !weightsNode->getMemoryPtr())
+        return;
+
+    const auto& weights = weightsNode->getMemoryPtr();
+    const float sparseRate = SparseWeights::getSparseRate(reinterpret_cast<const float*>(weights->GetPtr()),
+                                                          weights->GetShape().getElementsCount());
+    useSparseWeights = sparseRate >= minSparseRate;
+    if (!useSparseWeights)
+        return;
+
+    const auto& wghDims = weights->getStaticDims();
+    const auto data = reinterpret_cast<const float*>(weights->GetPtr());
+    auto create = [&] () {
+        const size_t size = SparseWeights::getCompressedSize(data, wghDims[0], wghDims[1]);
+        MemoryPtr ptr = std::make_shared<Memory>(getEngine());
+        ptr->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{size})));
+        SparseWeights::compress(data, wghDims[0], wghDims[1], ptr->GetPtr());
+        return ptr;
+    };
+
+    // the compressed weights are shared by the streams the same way as the other weights
+    if (weightCache != nullptr) {
+        const size_t byteSize = weights->GetSize();
+        const uint64_t dataHash = weightCache->GetHashFunc().hash(reinterpret_cast<const unsigned char*>(data), byteSize);
+        const std::string key = getName() + "_sparse_" + std::to_string(byteSize) + "_" + std::to_string(dataHash);
+        sparseWeightsMemory = *weightCache->findOrCreate(key, create);
+    } else {
+        sparseWeightsMemory = create();
+    }
+    sparseWeights = std::make_shared<SparseWeights>(sparseWeightsMemory->GetPtr(), wghDims[0], wghDims[1]);
+
+    // the dense weights aren't read by the sparse kernel
+    if (weightsNode->getChildEdges().size() == 1)
+        weightsNode->releaseBlobCopy();
+}
+
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the post operations are applied by oneDNN, which isn't used by the sparse and compressed weights kernels
+    if (useSparseWeights || useWeightsDecompression)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -522,6 +649,9 @@ void FullyConnected::createDescriptorInternal(const mkldnn::memory::desc &inputD
 
 void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useSparseWeights || useWeightsDecompression)
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -543,6 +673,22 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useSparseWeights) {
+        std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_sparse, true);
+        return;
+    }
+
+    if (useWeightsDecompression) {
+        // the weights are consumed in the compressed precision of the constant
+        const auto weightsPrecision = getParentEdgesAtPort(WEIGHTS_ID)[0]->getParent()->getOriginalOutputPrecisionAtPort(0);
+        std::vector<PortConfigurator> inConfs;
+        for (size_t i = 0; i < getOriginalInputsNumber(); i++)
+            inConfs.emplace_back(LayoutType::ncsp, i == WEIGHTS_ID ? weightsPrecision : Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any, true);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include "common/sparse_weights.h"
+#include "common/compressed_weights.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -56,6 +58,19 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * @brief Switches the node to the sparse weights kernel if the fraction of the zero weights
+     * is not less than minSparseRate. Must be called once the node is connected to the weights
+     * @param minSparseRate the value 1 keeps the dense execution
+     */
+    void initSparseWeightsDecompression(float minSparseRate);
+
+    /**
+     * @brief Makes the node consume the compressed weights directly, the f32 weights are
+     * weights[n, k] * scales[n] + shifts[n]. Must be called once the node is connected to the compressed weights
+     */
+    void fuseWeightsDecompression(std::vector<float> scales, std::vector<float> shifts);
+
 private:
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
@@ -67,8 +82,18 @@ private:
     VectorDims outDims;
 
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
+    void executeSparse();
+    void executeCompressed();
 
     bool withBiases = false;
+    bool useSparseWeights = false;
+    // the compressed weights shared through the weights cache and the view of them
+    MemoryCPtr sparseWeightsMemory;
+    std::shared_ptr<SparseWeights> sparseWeights;
+    bool useWeightsDecompression = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    std::shared_ptr<CompressedWeights> compressedWeights;
 
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
@@ -389,6 +389,23 @@ MemoryCPtr Input::getMemoryPtr() const {
     return memoryPtr;
 }
 
+void Input::releaseBlobCopy() {
+    if (!constOp || !memoryPtr || memoryPtr->GetData() == constOp->get_data_ptr())
+        return;
+
+    const auto& memDesc = memoryPtr->getDesc();
+    const auto prec = memDesc.getPrecision();
+    const void* data = constOp->get_data_ptr();
+    // the data has to fit the descriptor and be aligned
+    if (constOp->get_byte_size() < memDesc.getCurrentMemSize() ||
+        (prec.size() > 1 && reinterpret_cast<size_t>(data) % prec.size() != 0))
+        return;
+
+    auto ptr = std::make_shared<Memory>(getEngine());
+    ptr->Create(memDesc, data);
+    memoryPtr = ptr;
+}
+
 void Input::getSupportedDescriptors() {
     if (getType() == Type::Input) {
         if (!getParentEdges().empty())
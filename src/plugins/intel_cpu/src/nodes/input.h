@@ -28,6 +28,12 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    /**
+     * @brief Makes the memory refer to the data of the constant operation instead of the copy made for the weights
+     * sharing, so the copy is freed once no other graph uses it. Is called by the consumer, which doesn't read
+     * the data after the graph creation. Must be called before the memory allocation
+     */
+    void releaseBlobCopy();
 
     void executeDynamicImpl(mkldnn::stream strm) override {}
     bool isExecutable() const override {
@@ -6,6 +6,7 @@
 #include <mkldnn_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -78,9 +79,60 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::createPrimitive() {
+    parentEdgeBindable = isParentEdgeBindable();
+}
+
+bool MemoryOutput::isParentEdgeBindable() {
+    auto parentEdge = getParentEdgeAt(0);
+    auto parent = parentEdge->getParent();
+    // the producer output must be an exclusive buffer, which is not shared with any other edge
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+        return false;
+
+    // the data of the MemoryInput node is bound to the other state buffer
+    // Reorder, Transpose and Split bind the data pointers in prepareParams, so they would keep writing
+    // to the previous state buffer, optimized Concat is using different ptrs without offsets
+    if (one_of(parent->getType(), Type::Input, Type::MemoryInput, Type::Reorder, Type::Transpose, Type::Split))
+        return false;
+
+    if (parent->getType() == Type::Concatenation) {
+        auto concat = dynamic_cast<Concat*>(parent.get());
+        if (concat && concat->isOptimized())
+            return false;
+    }
+
+    const void* data = parentEdge->getMemory().GetData();
+    for (auto& edge : parent->getParentEdges()) {
+        auto e = edge.lock();
+        if (!e)
+            IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+        if (e->getMemory().GetData() == data)
+            return false;
+    }
+    return true;
+}
+
+void MemoryOutput::bindState(void* ptr, size_t size) {
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    IE_ASSERT(srcMemory.GetSize() == size) << "MemoryNode objects are not compatible. Has different sizes.";
+
+    stateHandle = ptr;
+    if (parentEdgeBindable)
+        getParentEdgeAt(0)->getMemoryPtr()->setDataHandle(ptr);
+}
+
 void MemoryOutput::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
+    if (stateHandle) {
+        // the producer has already written the data into the state buffer
+        if (!parentEdgeBindable)
+            cpu_memcpy(stateHandle, srcMemory.GetPtr(), srcMemory.GetSize());
+        return;
+    }
+
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
     inputMemoryNode->storeState(srcMemory);
@@ -124,6 +176,54 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    childEdgesBindable = isChildEdgesBindable();
+}
+
+bool MemoryInput::isChildEdgesBindable() {
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+        // the consumers must not modify the state buffer and must not cache the data pointer
+        // (Reorder, Transpose and Split bind it in prepareParams)
+        if (child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Type::Reorder, Type::Transpose, Type::Split, Type::Output))
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+void MemoryInput::bindState(void* ptr, size_t size) {
+    IE_ASSERT(dataStore->GetSize() == size) << "MemoryNode objects are not compatible. Has different sizes.";
+
+    dataStore->setDataHandle(ptr);
+    if (childEdgesBindable) {
+        for (auto& childEdge : getChildEdges()) {
+            auto ce = childEdge.lock();
+            if (!ce)
+                IE_THROW() << "Node " << getName() << " contains empty child edge";
+            ce->getMemoryPtr()->setDataHandle(ptr);
+        }
+    }
+    childEdgesBound = childEdgesBindable;
 }
 
 /**
@@ -160,6 +260,10 @@ void MemoryInput::storeState(const Memory &new_state) {
 }
 
 void MemoryInput::execute(mkldnn::stream strm) {
+    // the child edges already point to the state storage
+    if (childEdgesBound)
+        return;
+
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
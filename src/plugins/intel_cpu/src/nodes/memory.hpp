@@ -66,7 +66,7 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == Type::MemoryOutput;
@@ -76,12 +76,22 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief Redirects the state writes to the external buffer instead of the input sibling storage.
+     * If possible the producer writes into the buffer directly, otherwise the data is copied on execute.
+     */
+    void bindState(void* ptr, size_t size);
+
  private:
+    bool isParentEdgeBindable();
+
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    void* stateHandle = nullptr;
+    bool parentEdgeBindable = false;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -103,9 +113,20 @@ public:
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Uses the external buffer as the state storage.
+     * If possible the child edges point to the buffer directly, otherwise the data is copied on execute.
+     */
+    void bindState(void* ptr, size_t size);
+
  private:
+    bool isChildEdgesBindable();
+
     MemoryPtr dataStore;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    bool childEdgesBindable = false;
+    bool childEdgesBound = false;
 };
 
 }   // namespace node
@@ -32,6 +32,11 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+// the hard NMS of a class with at least this number of candidates is done by NonMaxSuppression::nmsBlocked
+constexpr size_t blockedNMSCandidatesThreshold = 4096;
+// the number of the candidates in a block of NonMaxSuppression::nmsBlocked, a multiple of 64 for the bitmasks
+constexpr size_t blockedNMSBlockSize = 256;
+
 template <cpu_isa_t isa>
 struct jit_uni_nms_kernel_f32 : public jit_uni_nms_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_nms_kernel_f32)
@@ -1009,7 +1014,9 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
             filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
             io_selection_size++;
-            if (sortedBoxSize > 1) {
+            if (sortedBoxSize >= blockedNMSCandidatesThreshold) {
+                io_selection_size = nmsBlocked(boxesPtr, sorted_boxes, batch_idx, class_idx, &filtBoxes[offset]);
+            } else if (sortedBoxSize > 1) {
                 if (nms_kernel) {
                     std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
                     std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
@@ -1073,6 +1080,135 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
     });
 }
 
+/*
+ * The hard NMS of a class with a large number of candidates. The greedy selection is done over the blocks of
+ * blockedNMSBlockSize sorted candidates, and the IoU computations of a block run in parallel:
+ *   1. every candidate of the block is checked against the boxes selected in the previous blocks;
+ *   2. every not suppressed candidate gets the bitmask of the next candidates of the block it overlaps with.
+ * The sequential sweep over the block then selects a candidate if it is not suppressed by the previous blocks
+ * and not masked by a candidate selected earlier in the block, which gives the same result as the greedy NMS.
+ */
+int NonMaxSuppression::nmsBlocked(const float *boxesPtr, const std::vector<std::pair<float, int>> &sortedBoxes,
+                                  int batchIdx, int classIdx, filteredBoxes *selectedBoxes) {
+    const size_t candidatesNum = sortedBoxes.size();
+    const size_t blockSize = blockedNMSBlockSize;
+    const size_t blockWords = blockSize / 64;
+
+    // the corners and the areas of the candidates of the current block for the vectorized IoU within it
+    std::vector<float> ymin(blockSize), xmin(blockSize), ymax(blockSize), xmax(blockSize), area(blockSize);
+
+    // the selected boxes coordinates in the layout of the jit kernel
+    std::vector<float> boxCoord0, boxCoord1, boxCoord2, boxCoord3;
+    if (nms_kernel) {
+        boxCoord0.resize(maxOutputBoxesPerClass);
+        boxCoord1.resize(maxOutputBoxesPerClass);
+        boxCoord2.resize(maxOutputBoxesPerClass);
+        boxCoord3.resize(maxOutputBoxesPerClass);
+    }
+
+    std::vector<uint64_t> overlapMasks(blockSize * blockWords);
+    std::vector<uint8_t> suppressedByPrevious(blockSize);
+    std::vector<uint64_t> suppressedInBlock(blockWords);
+    size_t selectedNum = 0;
+    for (size_t blockStart = 0; blockStart < candidatesNum && selectedNum < maxOutputBoxesPerClass; blockStart += blockSize) {
+        const size_t blockLength = (std::min)(blockSize, candidatesNum - blockStart);
+
+        // only the processed blocks are converted, the selection stops early with max_output_boxes_per_class
+        parallel_for(blockLength, [&](size_t i) {
+            const float *box = &boxesPtr[sortedBoxes[blockStart + i].second * 4];
+            if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+                ymin[i] = box[1] - box[3] / 2.f;
+                xmin[i] = box[0] - box[2] / 2.f;
+                ymax[i] = box[1] + box[3] / 2.f;
+                xmax[i] = box[0] + box[2] / 2.f;
+            } else {
+                ymin[i] = (std::min)(box[0], box[2]);
+                xmin[i] = (std::min)(box[1], box[3]);
+                ymax[i] = (std::max)(box[0], box[2]);
+                xmax[i] = (std::max)(box[1], box[3]);
+            }
+            area[i] = (ymax[i] - ymin[i]) * (xmax[i] - xmin[i]);
+        });
+
+        parallel_for(blockLength, [&](size_t i) {
+            const size_t candidate = blockStart + i;
+            const float *candidateBox = &boxesPtr[sortedBoxes[candidate].second * 4];
+            bool suppressed = false;
+            if (selectedNum > 0) {
+                if (nms_kernel) {
+                    int candidateStatus = NMSCandidateStatus::SELECTED;
+                    auto arg = jit_nms_args();
+                    arg.iou_threshold = static_cast<float*>(&iouThreshold);
+                    arg.score_threshold = static_cast<float*>(&scoreThreshold);
+                    arg.scale = static_cast<float*>(&scale);
+                    arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[0]);
+                    arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[0]);
+                    arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
+                    arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
+                    arg.selected_boxes_num = selectedNum;
+                    arg.candidate_box = candidateBox;
+                    arg.candidate_status = static_cast<int*>(&candidateStatus);
+                    (*nms_kernel)(&arg);
+                    suppressed = candidateStatus == NMSCandidateStatus::SUPPRESSED;
+                } else {
+                    for (size_t selected = selectedNum; selected-- > 0 && !suppressed;) {
+                        suppressed = intersectionOverUnion(candidateBox, &boxesPtr[selectedBoxes[selected].box_index * 4]) >= iouThreshold;
+                    }
+                }
+            }
+            suppressedByPrevious[i] = suppressed;
+
+            uint64_t *mask = &overlapMasks[i * blockWords];
+            std::fill(mask, mask + blockWords, 0);
+            if (suppressed)
+                return;
+
+            // the branchless loop over the next candidates is vectorized by the compiler
+            uint8_t overlaps[64];
+            for (size_t word = (i + 1) / 64; word * 64 < blockLength; word++) {
+                const size_t first = word * 64;
+                const size_t count = (std::min)(static_cast<size_t>(64), blockLength - first);
+                for (size_t k = 0; k < count; k++) {
+                    const size_t j = first + k;
+                    const float intersection = (std::max)((std::min)(ymax[i], ymax[j]) - (std::max)(ymin[i], ymin[j]), 0.f) *
+                                               (std::max)((std::min)(xmax[i], xmax[j]) - (std::max)(xmin[i], xmin[j]), 0.f);
+                    const float iou = intersection / (area[i] + area[j] - intersection);
+                    overlaps[k] = area[i] > 0.f && area[j] > 0.f && iou >= iouThreshold;
+                }
+                uint64_t bits = 0;
+                for (size_t k = 0; k < count; k++)
+                    bits |= static_cast<uint64_t>(overlaps[k]) << k;
+                mask[word] = bits;
+            }
+            // the candidate itself and the previous ones are not masked
+            if ((i + 1) / 64 < blockWords)
+                mask[(i + 1) / 64] &= ~((static_cast<uint64_t>(1) << ((i + 1) % 64)) - 1);
+        });
+
+        std::fill(suppressedInBlock.begin(), suppressedInBlock.end(), 0);
+        for (size_t i = 0; i < blockLength && selectedNum < maxOutputBoxesPerClass; i++) {
+            if (suppressedByPrevious[i] || ((suppressedInBlock[i / 64] >> (i % 64)) & 1))
+                continue;
+
+            const auto& candidate = sortedBoxes[blockStart + i];
+            selectedBoxes[selectedNum] = filteredBoxes(candidate.first, batchIdx, classIdx, candidate.second);
+            if (nms_kernel) {
+                boxCoord0[selectedNum] = boxesPtr[candidate.second * 4];
+                boxCoord1[selectedNum] = boxesPtr[candidate.second * 4 + 1];
+                boxCoord2[selectedNum] = boxesPtr[candidate.second * 4 + 2];
+                boxCoord3[selectedNum] = boxesPtr[candidate.second * 4 + 3];
+            }
+            selectedNum++;
+
+            const uint64_t *mask = &overlapMasks[i * blockWords];
+            for (size_t word = 0; word < blockWords; word++)
+                suppressedInBlock[word] |= mask[word];
+        }
+    }
+
+    return static_cast<int>(selectedNum);
+}
+
 void NonMaxSuppression::checkPrecision(const Precision& prec, const std::vector<Precision>& precList,
                                                            const std::string& name, const std::string& type) {
     if (std::find(precList.begin(), precList.end(), prec) == precList.end())
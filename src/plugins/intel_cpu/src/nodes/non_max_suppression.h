@@ -97,6 +97,9 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                              const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
+    int nmsBlocked(const float *boxesPtr, const std::vector<std::pair<float, int>> &sortedBoxes, int batchIdx, int classIdx,
+                   filteredBoxes *selectedBoxes);
+
     void executeDynamicImpl(mkldnn::stream strm) override;
 
     bool isExecutable() const override;
@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <dnnl_extension_utils.h>
+
+#include "rdft.h"
+#include "ie_parallel.hpp"
+#include "ie_precision.hpp"
+#include "utils/general_utils.h"
+#include "common/cpu_memcpy.h"
+#include <openvino/op/irdft.hpp>
+#include <openvino/op/rdft.hpp>
+
+using namespace mkldnn;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool RDFT::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ov::op::v9::RDFT>(op) && !std::dynamic_pointer_cast<const ov::op::v9::IRDFT>(op)) {
+            errorMessage = "Only opset9 RDFT/IRDFT operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+RDFT::RDFT(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache) :
+               Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    inverse = std::dynamic_pointer_cast<const ov::op::v9::IRDFT>(op) != nullptr;
+    errorPrefix = std::string(inverse ? "IRDFT" : "RDFT") + " layer with name '" + op->get_name() + "'";
+    const size_t inputsNumber = getOriginalInputsNumber();
+    if (inputsNumber != 2 && inputsNumber != 3) {
+        IE_THROW() << errorPrefix << " has invalid number of input/output edges: " << inputsNumber;
+    }
+
+    /* Data, the complex input of IRDFT has the extra dimension of the real and imaginary parts */
+    const auto dataRank = inputShapes[DATA_INDEX].getRank();
+    if (dataRank < (inverse ? 2 : 1)) {
+        IE_THROW() << errorPrefix << " has invalid 'data' input tensor with rank: " << dataRank;
+    }
+
+    /* Axes */
+    const auto axesRank = inputShapes[AXES_INDEX].getRank();
+    if (axesRank != 1) {
+        IE_THROW() << errorPrefix << " has invalid 'axes' input tensor with rank: " << axesRank;
+    }
+
+    /* Signal size */
+    if (inputsNumber > SIGNAL_SIZE_INDEX) {
+        const auto signalSizeRank = inputShapes[SIGNAL_SIZE_INDEX].getRank();
+        if (signalSizeRank != 1) {
+            IE_THROW() << errorPrefix << " has invalid 'signal_size' input tensor with rank: " << signalSizeRank;
+        }
+    }
+}
+
+void RDFT::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto& dataPrecision = getOriginalInputPrecisionAtPort(DATA_INDEX);
+    if (!dataPrecision.is_float()) {
+        IE_THROW() << errorPrefix << " has unsupported 'data' input precision: " << dataPrecision.name();
+    }
+
+    const auto& axesPrecision = getOriginalInputPrecisionAtPort(AXES_INDEX);
+    if (axesPrecision != Precision::I32 && axesPrecision != Precision::I64) {
+        IE_THROW() << errorPrefix << " has unsupported 'axes' input precision: " << axesPrecision.name();
+    }
+
+    if (inputShapes.size() > SIGNAL_SIZE_INDEX) {
+        const auto& signalSizePrecision = getOriginalInputPrecisionAtPort(SIGNAL_SIZE_INDEX);
+        if (signalSizePrecision != Precision::I32 && signalSizePrecision != Precision::I64) {
+            IE_THROW() << errorPrefix << " has unsupported 'signal_size' input precision: " << signalSizePrecision.name();
+        }
+    }
+
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, Precision::FP32},
+                                                       {LayoutType::ncsp, Precision::I32}});
+    if (inputShapes.size() > SIGNAL_SIZE_INDEX)
+        inDataConfigurators.push_back({LayoutType::ncsp, Precision::I32});
+
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::ref_any);
+}
+
+std::vector<VectorDims> RDFT::shapeInfer() const {
+    return Node::shapeInferGeneric(PortMask(AXES_INDEX, SIGNAL_SIZE_INDEX));
+}
+
+bool RDFT::needShapeInfer() const {
+    // the output shape depends on the values of 'axes' and 'signal_size' as well
+    return Node::needShapeInfer() || readInputValues(AXES_INDEX) != axesValues ||
+           readInputValues(SIGNAL_SIZE_INDEX) != signalSizeValues;
+}
+
+void RDFT::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
+std::vector<int32_t> RDFT::readInputValues(size_t port) const {
+    if (port >= inputShapes.size())
+        return {};
+    const auto& memory = getParentEdgeAt(port)->getMemory();
+    const auto* values = reinterpret_cast<const int32_t*>(memory.GetPtr());
+    return std::vector<int32_t>(values, values + memory.getStaticDims()[0]);
+}
+
+const FFTPlan& RDFT::getFFTPlan(size_t length) {
+    auto& plan = fftPlans[length];
+    if (!plan)
+        plan = std::make_shared<FFTPlan>(length, inverse);
+    return *plan;
+}
+
+const RealFFTPlan& RDFT::getRealFFTPlan(size_t length) {
+    auto& plan = realFFTPlans[length];
+    if (!plan)
+        plan = std::make_shared<RealFFTPlan>(length, inverse);
+    return *plan;
+}
+
+namespace {
+
+/*
+    Computes the offsets of the 1D line along the axis in the source and the destination tensors, the lines are
+    numbered over the first rank dimensions of the shape except the axis. Returns false if the line is out of the
+    bounds of the source tensor, i.e. it is the zero padding.
+*/
+bool lineOffsets(size_t line, size_t axis, size_t rank, const VectorDims& shape, const VectorDims& bounds,
+                 const VectorDims& srcStrides, const VectorDims& dstStrides, size_t& srcOffset, size_t& dstOffset) {
+    srcOffset = 0;
+    dstOffset = 0;
+    bool inBounds = true;
+    for (size_t dim = rank; dim-- > 0;) {
+        if (dim == axis)
+            continue;
+        const size_t coord = line % shape[dim];
+        line /= shape[dim];
+        inBounds = inBounds && coord < bounds[dim];
+        srcOffset += coord * srcStrides[dim];
+        dstOffset += coord * dstStrides[dim];
+    }
+    return inBounds;
+}
+
+size_t linesNumber(size_t axis, size_t rank, const VectorDims& shape) {
+    size_t number = 1;
+    for (size_t dim = 0; dim < rank; dim++) {
+        if (dim != axis)
+            number *= shape[dim];
+    }
+    return number;
+}
+
+}   // namespace
+
+void RDFT::execute(mkldnn::stream strm) {
+    axesValues = readInputValues(AXES_INDEX);
+    signalSizeValues = readInputValues(SIGNAL_SIZE_INDEX);
+
+    const auto& outputDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    if (std::find(outputDims.begin(), outputDims.end(), 0) != outputDims.end())
+        return;
+
+    // the rank of the real signal, the axes of both operations are normalized by it
+    const auto realRank = static_cast<int32_t>(inverse ? outputDims.size() : outputDims.size() - 1);
+    axes.resize(axesValues.size());
+    for (size_t i = 0; i < axesValues.size(); i++) {
+        const int32_t axis = axesValues[i] < 0 ? axesValues[i] + realRank : axesValues[i];
+        if (axis < 0 || axis >= realRank)
+            IE_THROW() << errorPrefix << " has invalid axis: " << axesValues[i];
+        axes[i] = static_cast<size_t>(axis);
+    }
+
+    // the signal sizes are the output dims except the last axis of RDFT halved by the transform
+    std::vector<size_t> signalSizes(axes.size());
+    for (size_t i = 0; i < axes.size(); i++)
+        signalSizes[i] = outputDims[axes[i]];
+    if (!inverse) {
+        const auto& inputDims = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims();
+        const bool hasSignalSize = !signalSizeValues.empty() && signalSizeValues.back() != -1;
+        signalSizes.back() = hasSignalSize ? static_cast<size_t>(signalSizeValues.back()) : inputDims[axes.back()];
+    }
+
+    if (inverse) {
+        executeIRDFT(signalSizes);
+    } else {
+        executeRDFT(signalSizes);
+    }
+}
+
+void RDFT::executeRDFT(const std::vector<size_t>& signalSizes) {
+    const auto& inputMemory = getParentEdgeAt(DATA_INDEX)->getMemory();
+    const auto& outputMemory = getChildEdgeAt(0)->getMemory();
+    const auto* input = reinterpret_cast<const float*>(inputMemory.GetPtr());
+    auto* output = reinterpret_cast<float*>(outputMemory.GetPtr());
+    const auto& inputDims = inputMemory.getStaticDims();
+    const auto& outputDims = outputMemory.getStaticDims();
+    const auto inputStrides = inputMemory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+    const auto outputStrides = outputMemory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+
+    // the real transform of the last axis, the input is cropped or padded with zeros to the signal sizes
+    const size_t axis = axes.back();
+    const size_t realLength = signalSizes.back();
+    const size_t complexLength = realLength / 2 + 1;
+    const size_t copyLength = std::min(realLength, inputDims[axis]);
+    const size_t lines = linesNumber(axis, inputDims.size(), outputDims);
+    const auto& realPlan = getRealFFTPlan(realLength);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(lines, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> scratch(realPlan.getScratchSize() + realLength + 2 * complexLength);
+        float* signal = scratch.data() + realPlan.getScratchSize();
+        float* spectrumLine = signal + realLength;
+        for (size_t line = start; line < end; ++line) {
+            size_t inputOffset, outputOffset;
+            const bool inBounds = lineOffsets(line, axis, inputDims.size(), outputDims, inputDims,
+                                              inputStrides, outputStrides, inputOffset, outputOffset);
+            float* dst = outputStrides[axis] == 2 ? output + outputOffset : spectrumLine;
+            if (inBounds) {
+                for (size_t n = 0; n < copyLength; n++)
+                    signal[n] = input[inputOffset + n * inputStrides[axis]];
+                std::fill(signal + copyLength, signal + realLength, 0.f);
+                realPlan.execute(signal, dst, scratch.data());
+            } else {
+                std::fill(dst, dst + 2 * complexLength, 0.f);
+            }
+            if (dst == spectrumLine) {
+                for (size_t k = 0; k < complexLength; k++) {
+                    output[outputOffset + k * outputStrides[axis]] = spectrumLine[2 * k];
+                    output[outputOffset + k * outputStrides[axis] + 1] = spectrumLine[2 * k + 1];
+                }
+            }
+        }
+    });
+
+    for (size_t i = 0; i + 1 < axes.size(); i++)
+        fftAlongAxis(getFFTPlan(signalSizes[i]), output, outputDims, outputStrides, axes[i]);
+}
+
+void RDFT::executeIRDFT(const std::vector<size_t>& signalSizes) {
+    const auto& inputMemory = getParentEdgeAt(DATA_INDEX)->getMemory();
+    const auto& outputMemory = getChildEdgeAt(0)->getMemory();
+    const auto* input = reinterpret_cast<const float*>(inputMemory.GetPtr());
+    auto* output = reinterpret_cast<float*>(outputMemory.GetPtr());
+    const auto& inputDims = inputMemory.getStaticDims();
+    const auto& outputDims = outputMemory.getStaticDims();
+    const auto inputStrides = inputMemory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+    const auto outputStrides = outputMemory.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+    const size_t rank = outputDims.size();
+
+    // the spectrum cropped or padded with zeros to the signal sizes, the last axis keeps the non-redundant half
+    const size_t axis = axes.back();
+    const size_t realLength = signalSizes.back();
+    const size_t complexLength = realLength / 2 + 1;
+    VectorDims spectrumDims = inputDims;
+    for (size_t i = 0; i + 1 < axes.size(); i++)
+        spectrumDims[axes[i]] = signalSizes[i];
+    spectrumDims[axis] = complexLength;
+    VectorDims spectrumStrides(spectrumDims.size(), 1);
+    for (size_t dim = spectrumDims.size() - 1; dim-- > 0;)
+        spectrumStrides[dim] = spectrumStrides[dim + 1] * spectrumDims[dim + 1];
+    spectrum.resize(spectrumStrides[0] * spectrumDims[0]);
+
+    const size_t innerLength = 2 * std::min(inputDims[rank - 1], spectrumDims[rank - 1]);
+    const size_t rowLength = 2 * spectrumDims[rank - 1];
+    parallel_for(linesNumber(rank - 1, rank, spectrumDims), [&](size_t row) {
+        size_t inputOffset, spectrumOffset;
+        float* dst = spectrum.data();
+        if (lineOffsets(row, rank - 1, rank, spectrumDims, inputDims, inputStrides, spectrumStrides, inputOffset, spectrumOffset)) {
+            cpu_memcpy(dst + spectrumOffset, input + inputOffset, innerLength * sizeof(float));
+            std::fill(dst + spectrumOffset + innerLength, dst + spectrumOffset + rowLength, 0.f);
+        } else {
+            std::fill(dst + spectrumOffset, dst + spectrumOffset + rowLength, 0.f);
+        }
+    });
+
+    for (size_t i = 0; i + 1 < axes.size(); i++)
+        fftAlongAxis(getFFTPlan(signalSizes[i]), spectrum.data(), spectrumDims, spectrumStrides, axes[i]);
+
+    // the real inverse transform of the last axis
+    const size_t lines = linesNumber(axis, rank, outputDims);
+    const auto& realPlan = getRealFFTPlan(realLength);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(lines, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> scratch(realPlan.getScratchSize() + realLength + 2 * complexLength);
+        float* signal = scratch.data() + realPlan.getScratchSize();
+        float* spectrumLine = signal + realLength;
+        for (size_t line = start; line < end; ++line) {
+            size_t spectrumOffset, outputOffset;
+            lineOffsets(line, axis, rank, outputDims, outputDims, spectrumStrides, outputStrides, spectrumOffset, outputOffset);
+            const float* src = spectrum.data() + spectrumOffset;
+            if (spectrumStrides[axis] != 2) {
+                for (size_t k = 0; k < complexLength; k++) {
+                    spectrumLine[2 * k] = src[k * spectrumStrides[axis]];
+                    spectrumLine[2 * k + 1] = src[k * spectrumStrides[axis] + 1];
+                }
+                src = spectrumLine;
+            }
+            float* dst = outputStrides[axis] == 1 ? output + outputOffset : signal;
+            realPlan.execute(src, dst, scratch.data());
+            if (dst == signal) {
+                for (size_t n = 0; n < realLength; n++)
+                    output[outputOffset + n * outputStrides[axis]] = signal[n];
+            }
+        }
+    });
+}
+
+bool RDFT::created() const {
+    return getType() == Type::RDFT;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/fft.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+/**
+ * RDFT and IRDFT (opset9). The real signal is transformed along the last axis from 'axes' by the real FFT computing
+ * the non-redundant half of the spectrum only, the other axes are transformed by the complex FFT.
+ */
+class RDFT : public Node {
+public:
+    RDFT(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    std::vector<VectorDims> shapeInfer() const override;
+    bool needShapeInfer() const override;
+    bool needPrepareParams() const override { return false; };
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    std::vector<int32_t> readInputValues(size_t port) const;
+    void executeRDFT(const std::vector<size_t>& signalSizes);
+    void executeIRDFT(const std::vector<size_t>& signalSizes);
+
+    const FFTPlan& getFFTPlan(size_t length);
+    const RealFFTPlan& getRealFFTPlan(size_t length);
+
+    // the plans are cached by the signal length, the direction is the one of the node
+    std::unordered_map<size_t, FFTPlan::Ptr> fftPlans;
+    std::unordered_map<size_t, RealFFTPlan::Ptr> realFFTPlans;
+    // the values of 'axes' and 'signal_size' of the last execution to detect the output shape change
+    std::vector<int32_t> axesValues;
+    std::vector<int32_t> signalSizeValues;
+    // the normalized axes, the last one is transformed by the real FFT
+    std::vector<size_t> axes;
+    // the complex spectrum of IRDFT cropped or padded to the signal sizes
+    std::vector<float> spectrum;
+
+    std::string errorPrefix;
+    const size_t DATA_INDEX = 0;
+    const size_t AXES_INDEX = 1;
+    const size_t SIGNAL_SIZE_INDEX = 2;
+    bool inverse;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -23,6 +23,7 @@
 
 #include <snippets/op/subgraph.hpp>
 #include "emitters/cpu_generator.hpp"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace InferenceEngine;
 using namespace mkldnn::impl::utils;
@@ -33,28 +34,56 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+// Creates a deep local copy of the input snippet to perform canonicalization & code generation
+// Todo: Probably better to implement a proper copy constructor
+std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet(const std::shared_ptr<ngraph::snippets::op::Subgraph>& original,
+                                                            cpu_isa_t host_isa) {
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : original->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*original->get_body().get());
+    auto snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original, snippet);
+    snippet->set_friendly_name(original->get_friendly_name());
+    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    return snippet;
+}
+
+struct SnippetKey {
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    // inputs, then outputs: true if the innermost dimension is equal to 1
+    std::vector<bool> unitInnerDims;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, snippet.get());
+        for (bool unit : unitInnerDims)
+            seed = hash_combine(seed, unit);
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return snippet == rhs.snippet && unitInnerDims == rhs.unitInnerDims;
+    }
+};
+
+} // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_common) ?
         dnnl::impl::cpu::x64::avx512_common : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
-    if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
-    } else {
+    original_snippet = ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    if (!original_snippet)
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
-    }
+    snippet = copy_snippet(original_snippet, host_isa);
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
@@ -72,11 +101,14 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // Reductions are performed along the innermost dimension, so it must be the innermost dimension of the planar layout
+    const bool hasReductions = snippet->has_reductions();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    // Dynamic shapes are scheduled without canonicalization, which is trivial only for the planar and channels first layouts.
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions && !isDynamicNode();
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -170,6 +202,11 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
 }
 
 void Snippet::createPrimitive() {
+    // the kernels for dynamic shapes are compiled in prepareParams, when the shapes are known
+    if (isDynamicNode()) {
+        Node::createPrimitive();
+        return;
+    }
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
@@ -186,7 +223,7 @@ void Snippet::execute(dnnl::stream strm) {
     if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
-    jit_snippets_call_args call_args;
+    jit_snippets_call_args call_args = runtime_args;
     for (size_t i = 0; i < srcMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(srcMemPtrs[i]->GetData()) + start_offset_in[i];
 
@@ -200,6 +237,47 @@ void Snippet::execute(dnnl::stream strm) {
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+std::vector<VectorDims> Snippet::shapeInfer() const {
+    // Dynamic snippets have a single output, which is the numpy broadcast of the inputs since the body is elementwise
+    if (outputShapes.size() != 1)
+        return Node::shapeInfer();
+    ov::PartialShape outShape = getParentEdgesAtPort(0)[0]->getMemory().GetShape().toPartialShape();
+    for (size_t i = 1; i < getParentEdges().size(); i++) {
+        ov::PartialShape::broadcast_merge_into(outShape, getParentEdgesAtPort(i)[0]->getMemory().GetShape().toPartialShape(),
+                                               ov::op::AutoBroadcastType::NUMPY);
+    }
+    if (outShape.is_dynamic())
+        IE_THROW() << "Can't compute static output shape for Subgraph node with name: " << getName();
+    return {outShape.get_shape()};
+}
+
+void Snippet::prepareParams() {
+    define_schedule();
+    canUseOptimizedImpl = copy_schedule(runtime_args.scheduler_dims, runtime_args.scheduler_offsets, runtime_args.data_offsets);
+    if (!canUseOptimizedImpl)
+        return;
+
+    // The loads, stores and broadcasts of the generated code depend only on whether the innermost dimensions are equal to 1
+    // (note that dims collapsing keeps it), the rest of the schedule is passed to the kernel in runtime
+    SnippetKey key = {original_snippet, {}};
+    for (const auto& d : dims_in)
+        key.unitInnerDims.push_back(d.back() == 1);
+    for (const auto& d : dims_out)
+        key.unitInnerDims.push_back(d.back() == 1);
+
+    auto builder = [this](const SnippetKey&) {
+        return compile_dynamic();
+    };
+    // the compiled kernel keeps no state between the executions, so the streams share it
+    auto result = getSharedRuntimeCache()->getOrCreate(key, builder);
+    compiled_snippet = result.first;
+    schedule = compiled_snippet->schedule;
+}
+
 bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
@@ -250,7 +328,8 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
     }
 }
 
-void Snippet::define_schedule() {
+void Snippet::get_blocked_shapes(ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                                 ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const {
     auto edgeToBlockedShape = [](const EdgePtr& edge) {
         const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
         ngraph::Shape shape(blockedDesc->getBlockDims());
@@ -258,6 +337,16 @@ void Snippet::define_schedule() {
         ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
         return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
     };
+    input_blocked_shapes.clear();
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
+
+    output_blocked_shapes.clear();
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
+}
+
+void Snippet::define_schedule() {
     auto prependWithOnes = [this](const std::vector<size_t>& dims) {
         if (tensorRank <= dims.size())
             return dims;
@@ -266,25 +355,42 @@ void Snippet::define_schedule() {
         return result;
     };
     ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
-    for (size_t i = 0; i < inputShapes.size(); i++)
-        input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
-
     ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
-    for (size_t i = 0; i < outputShapes.size(); i++)
-        output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
-    exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
-    // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
-    tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
-    // Canonicalization broadcasts inputs and outputs to max input rank, which can be smaller than tensorRank
-    // prepend to enable 6D scheduler
-    exec_domain = prependWithOnes(exec_domain);
-    const auto &body = snippet->get_body();
-    for (const auto& p : body->get_parameters()) {
-        dims_in.emplace_back(prependWithOnes(p->get_shape()));
-    }
+    get_blocked_shapes(input_blocked_shapes, output_blocked_shapes);
+
+    // the schedule is redefined on every shape change for dynamic shapes
+    dims_in.clear();
+    dims_out.clear();
+    tileRank = 1;
+    if (!isDynamicNode()) {
+        exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+        // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
+        tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
+        // Canonicalization broadcasts inputs and outputs to max input rank, which can be smaller than tensorRank
+        // prepend to enable 6D scheduler
+        exec_domain = prependWithOnes(exec_domain);
+        const auto &body = snippet->get_body();
+        for (const auto& p : body->get_parameters()) {
+            dims_in.emplace_back(prependWithOnes(p->get_shape()));
+        }
 
-    for (size_t i = 0; i < body->get_output_size(); i++) {
-        dims_out.push_back(prependWithOnes(body->get_output_shape(i)));
+        for (size_t i = 0; i < body->get_output_size(); i++) {
+            dims_out.push_back(prependWithOnes(body->get_output_shape(i)));
+        }
+    } else {
+        // The planar and channels first layouts of equal ranks are canonicalized by prepending the shapes with ones,
+        // so the body is canonicalized only when a kernel is compiled, see compile_dynamic()
+        tensorRank = rank6D;
+        for (const auto& s : output_blocked_shapes)
+            tensorRank = std::max(tensorRank, std::get<0>(s).size());
+        exec_domain.assign(tensorRank, 1);
+        for (const auto& s : input_blocked_shapes)
+            dims_in.emplace_back(prependWithOnes(std::get<0>(s)));
+        for (const auto& s : output_blocked_shapes) {
+            dims_out.emplace_back(prependWithOnes(std::get<0>(s)));
+            for (size_t j = 0; j < tensorRank; j++)
+                exec_domain[j] = std::max(exec_domain[j], dims_out.back()[j]);
+        }
     }
 
     const auto config = getSelectedPrimitiveDescriptor()->getConfig();
@@ -328,7 +434,9 @@ void Snippet::define_schedule() {
         }
     };
 
-    auto find_dims_to_collapse = [this, config]() -> int {
+    // the rows must not be collapsed if the reductions are performed over them, tile 2D is used instead
+    const bool hasReductions = snippet->has_reductions();
+    auto find_dims_to_collapse = [this, config, hasReductions]() -> int {
         int collapsedDims = 0;
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
@@ -337,8 +445,8 @@ void Snippet::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            bool canCollapse = !hasReductions;
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -376,9 +484,9 @@ void Snippet::define_schedule() {
 
     auto initSchedulingInfo = [this, dataSize]() -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
+        sch_offsets_in.assign(offsets_in.size(), 0);
+        sch_offsets_out.assign(offsets_out.size(), 0);
+        sch_dims.assign(maxTileRank, 1);
         sch_dims[maxTileRank-1] = exec_domain.back();
         schedulerWorkAmount = fullWorkAmount / exec_domain.back();
         if (tileRank > 1) {
@@ -416,28 +524,52 @@ void Snippet::define_schedule() {
     initSchedulingInfo();
 }
 
-void Snippet::generate() {
-    jit_snippets_compile_args jcp;
-    jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
+bool Snippet::copy_schedule(int64_t* scheduler_dims, int64_t* scheduler_offsets, int64_t* data_offsets) const {
+    std::copy(sch_dims.begin(), sch_dims.end(), scheduler_dims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &scheduler_offsets[sch_offsets_in.size()]);
+    bool fits = true;
+    size_t harness_num_dims = exec_domain.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
-        canUseOptimizedImpl = false;
+        fits = false;
         harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &data_offsets[i * harness_num_dims]);
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &data_offsets[(inputShapes.size() + i) * harness_num_dims]);
     }
+    return fits;
+}
+
+void Snippet::generate() {
+    jit_snippets_compile_args jcp;
+    jcp.output_dims = exec_domain;
+    if (!copy_schedule(jcp.scheduler_dims, jcp.scheduler_offsets, jcp.data_offsets))
+        canUseOptimizedImpl = false;
     schedule = snippet->generate(reinterpret_cast<void*>(&jcp));
 }
 
+std::shared_ptr<Snippet::CompiledSnippet> Snippet::compile_dynamic() const {
+    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
+    get_blocked_shapes(input_blocked_shapes, output_blocked_shapes);
+
+    // The kernel is compiled for the current shapes, but takes the schedule from the call args,
+    // so every compilation needs its own copy of the snippet to canonicalize it and to own the code
+    auto compiled = std::make_shared<CompiledSnippet>();
+    compiled->snippet = copy_snippet(original_snippet, host_isa);
+    jit_snippets_compile_args jcp;
+    jcp.is_dynamic = true;
+    jcp.output_dims = exec_domain;
+    copy_schedule(jcp.scheduler_dims, jcp.scheduler_offsets, jcp.data_offsets);
+    compiled->schedule = compiled->snippet->generate(output_blocked_shapes, input_blocked_shapes, reinterpret_cast<void*>(&jcp));
+    return compiled;
+}
+
 void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
     const auto& dom = exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
@@ -40,15 +40,35 @@ public:
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(mkldnn::stream strm) override;
 
+    // For dynamic shapes the kernel is compiled per broadcasting pattern of the innermost dimensions and reused
+    // for all the shapes with this pattern, the shape change only recomputes the schedule passed to the kernel in runtime
+    std::vector<VectorDims> shapeInfer() const override;
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
+    // Holds the kernel compiled for dynamic shapes along with the local copy of the subgraph owning the code
+    struct CompiledSnippet {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+
+    void get_blocked_shapes(ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                            ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) const;
+
     void define_schedule();
 
+    // Copies the scheduling info to the kernel arguments, returns false if the harness has too many dims for the kernel
+    bool copy_schedule(int64_t* scheduler_dims, int64_t* scheduler_offsets, int64_t* data_offsets) const;
+
     void generate();
 
+    std::shared_ptr<CompiledSnippet> compile_dynamic() const;
+
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
     void schedule_nt(const jit_snippets_call_args& const_args) const;
@@ -56,6 +76,13 @@ private:
     // Local copy of subgraph node for canonization & code generation
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
+    // Original subgraph node (common for the graphs of all the streams) identifies the dynamic kernels in the shared
+    // runtime cache, so the streams share the kernels
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original_snippet;
+    std::shared_ptr<CompiledSnippet> compiled_snippet;
+    // The schedule passed to the dynamic kernel in runtime, the data pointers are set on every execution
+    jit_snippets_call_args runtime_args;
+
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
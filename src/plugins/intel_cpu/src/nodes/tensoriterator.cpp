@@ -5,6 +5,7 @@
 #include "tensoriterator.h"
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <dnnl_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
@@ -77,6 +78,35 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the nodes which bind the data pointers of their memory on the params preparation
+static bool bindsDataPointers(const NodePtr& node) {
+    return one_of(node->getType(), Type::Reorder, Type::Transpose, Type::Split);
+}
+
+// The buffers of the back edge ends may be exchanged if they have the same layout and are the separate buffers
+// of the body memory workspace (the body inputs and outputs are never reused by the other edges). All the edges
+// sharing the buffers must have the same size and access them through the memory managers only.
+static bool canSwapBackEdge(const MemoryPtr& from, const MemoryPtr& to, Graph& body) {
+    if (!from->getDesc().isCompatible(to->getDesc()))
+        return false;
+
+    const auto from_mngr = from->getDnnlMemoryMngr();
+    const auto to_mngr = to->getDnnlMemoryMngr();
+    if (!from_mngr || !to_mngr || from_mngr == to_mngr || !from_mngr->hasExtBuffer() || !to_mngr->hasExtBuffer())
+        return false;
+
+    const auto size = to->GetSize();
+    for (auto& edge : body.GetEdges()) {
+        const auto mngr = edge->getMemoryPtr()->getDnnlMemoryMngr();
+        if (mngr != from_mngr && mngr != to_mngr)
+            continue;
+        if (edge->getMemory().GetSize() != size || edge->getParent()->isConstant() ||
+            bindsDataPointers(edge->getParent()) || bindsDataPointers(edge->getChild()))
+            return false;
+    }
+    return true;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -159,6 +189,29 @@ public:
     }
 };
 
+/**
+ * Moves the back edge data by the exchange of the body output and the body input buffers instead of the copy.
+ * The buffers are exchanged through the memory managers, so all the memory objects sharing them are updated.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to)
+        : from_mngr(from->getDnnlMemoryMngr()), to_mngr(to->getDnnlMemoryMngr()), size(to->GetSize()) {}
+
+    void execute(mkldnn::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            void* from_ptr = from_mngr->getRawPtr();
+            from_mngr->setExtBuff(to_mngr->getRawPtr(), size);
+            to_mngr->setExtBuff(from_ptr, size);
+        }
+    }
+
+private:
+    DnnlMemoryMngrPtr from_mngr;
+    DnnlMemoryMngrPtr to_mngr;
+    size_t size;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const mkldnn::engine& eng) {
@@ -228,89 +281,89 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
+void DynamicBuffer::reset(const int max_iter_count_) {
+    max_iter_count = max_iter_count_;
+    num_execs = 0;
+    mem_holder_buffer.reset();
+}
+
 void DynamicBuffer::execute(const mkldnn::engine& eng, const int iter) {
+    const auto abs_stride = std::abs(map_rule.stride);
+    if (from->getStaticDims()[map_rule.axis] != abs_stride)
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+                   " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
     if (iter == 0) {
         init(eng);
-        return;
+    } else if (num_execs == capacity) {
+        const auto new_capacity = 2 * capacity;
+        move_buffer(create_buffer(eng, new_capacity), new_capacity);
     }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
     move_data();
+    num_execs++;
 }
 
 void DynamicBuffer::init(const mkldnn::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    // the buffer for the known number of iterations is allocated at once unless it is too large
+    // (the loop may be stopped by the condition much earlier), the rest is covered by the growth
+    constexpr size_t max_preallocated_size = 64 * 1024 * 1024;
 
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
-
-    if (dims[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-                   " is expected, but actual: " << dims[axis];
-
-    count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, 1, std::multiplies<size_t>());
+    const auto dims = from->getStaticDims();
+    count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
-
-std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
+    chunk_size_in_byte = std::abs(map_rule.stride) * len;
 
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
-
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
-
-    dims[axis] += abs_stride;
-    mkldnn::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
-
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
+    num_execs = 0;
+    capacity = 1;
+    if (max_iter_count > 1) {
+        const auto iter_size = std::max(count * chunk_size_in_byte, size_t(1));
+        capacity = std::max(std::min(static_cast<size_t>(max_iter_count), max_preallocated_size / iter_size), size_t(1));
     }
+    mem_holder_buffer = create_buffer(eng, capacity);
+}
+
+std::shared_ptr<mkldnn::memory> DynamicBuffer::create_buffer(const mkldnn::engine& eng, const size_t new_capacity) {
+    auto dims = DnnlExtensionUtils::convertToDnnlDims(from->getStaticDims());
+    dims[map_rule.axis] = new_capacity * std::abs(map_rule.stride);
+    mkldnn::memory::desc new_buffer_desc(dims, from->GetDataType(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
 
     return std::make_shared<mkldnn::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_capacity) {
+    // the chunks are kept at the beginning of the buffer for the positive stride and at the end otherwise
+    const auto src_stride = capacity * chunk_size_in_byte;
+    const auto src_offset = valid_data_offset();
+    capacity = new_capacity;
+    const auto dst_stride = capacity * chunk_size_in_byte;
+    const auto dst_offset = valid_data_offset();
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+    copy(get_ptr(*mem_holder_buffer.get()) + src_offset, get_ptr(*new_buffer.get()) + dst_offset,
+         src_stride, dst_stride, count, num_execs * chunk_size_in_byte);
     mem_holder_buffer = new_buffer;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    const auto slot = map_rule.stride > 0 ? num_execs : capacity - 1 - num_execs;
+
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + slot * chunk_size_in_byte,
+         chunk_size_in_byte, capacity * chunk_size_in_byte, count, chunk_size_in_byte);
+}
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+size_t DynamicBuffer::valid_data_offset() const {
+    return map_rule.stride > 0 ? 0 : (capacity - num_execs) * chunk_size_in_byte;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
     if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+        auto dims = from->getStaticDims();
+        dims[map_rule.axis] = num_execs * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        copy(get_ptr(*mem_holder_buffer.get()) + valid_data_offset(), reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             capacity * chunk_size_in_byte, num_execs * chunk_size_in_byte, count, num_execs * chunk_size_in_byte);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -545,6 +598,8 @@ void TensorIterator::executeDynamicImpl(mkldnn::stream strm) {
 
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
+    for (auto& buffer : buffers)
+        buffer->reset(max_num_iter);
 
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
@@ -600,11 +655,21 @@ void TensorIterator::prepareOutputPorts() {
 
 void TensorIterator::prepareBackEdges() {
     const auto &eng = getEngine();
+    // each buffer may take part in a single exchange
+    std::unordered_set<DnnlMemoryMngrPtr> swapped_mngrs;
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        const auto from_mngr = from_mem->getDnnlMemoryMngr();
+        const auto to_mngr = to_mem->getDnnlMemoryMngr();
+        if (!swapped_mngrs.count(from_mngr) && !swapped_mngrs.count(to_mngr) && canSwapBackEdge(from_mem, to_mem, sub_graph)) {
+            swapped_mngrs.insert(from_mngr);
+            swapped_mngrs.insert(to_mngr);
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        }
     }
 }
 
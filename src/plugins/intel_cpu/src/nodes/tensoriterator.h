@@ -60,13 +60,16 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer is preallocated for the known number of iterations and grows geometrically
+ * along the concatenation axis otherwise, so the output of each iteration is copied once into its slice.
  */
 class DynamicBuffer {
 public:
     DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
     ~DynamicBuffer() = default;
 
+    void reset(const int max_iter_count_);
     void execute(const mkldnn::engine& eng, const int iter);
     void transfer(const Node* node);
 
@@ -74,9 +77,10 @@ private:
     void init(const mkldnn::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng);
-    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer);
+    std::shared_ptr<mkldnn::memory> create_buffer(const mkldnn::engine& eng, const size_t new_capacity);
+    void move_buffer(std::shared_ptr<mkldnn::memory> new_buffer, const size_t new_capacity);
     void move_data();
+    size_t valid_data_offset() const;
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(mkldnn::memory& prim);
@@ -84,8 +88,11 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;
+
+    int max_iter_count = -1;
+    size_t num_execs = 0lu;  /**< Number of the chunks stored in the buffer */
+    size_t capacity = 0lu;   /**< Number of the chunks the buffer can hold */
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
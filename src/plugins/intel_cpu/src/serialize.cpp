@@ -4,8 +4,12 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <ie_shared_stream_buffer.hpp>
 
 #include <pugixml.hpp>
+#include <mkldnn.hpp>
+
+#include <cstring>
 
 using namespace InferenceEngine;
 
@@ -65,6 +69,33 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // the precomputed constants section follows the network
+    constexpr char constantsMagic[] = "CPUCONST";
+    constexpr uint32_t constantsVersion = 1;
+
+    template<typename T>
+    void write(std::ostream & stream, const T & value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+    }
+
+    void write(std::ostream & stream, const std::string & str) {
+        write(stream, static_cast<uint64_t>(str.size()));
+        stream.write(str.data(), str.size());
+    }
+
+    template<typename T>
+    bool read(std::istream & stream, T & value) {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof value));
+    }
+
+    bool read(std::istream & stream, std::string & str) {
+        uint64_t size = 0;
+        if (!read(stream, size))
+            return false;
+        str.resize(size);
+        return static_cast<bool>(stream.read(&str[0], size));
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -125,6 +156,20 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
+void CNNNetworkSerializer::operator << (const PrecomputedConstants & constants) {
+    _ostream.write(constantsMagic, sizeof constantsMagic);
+    write(_ostream, constantsVersion);
+    // the layouts of the constants depend on the ISA the graph was compiled for
+    write(_ostream, static_cast<int32_t>(dnnl::get_effective_cpu_isa()));
+    write(_ostream, static_cast<uint64_t>(constants.size()));
+    for (const auto & constant : constants) {
+        write(_ostream, constant.first);
+        write(_ostream, constant.second.signature);
+        write(_ostream, static_cast<uint64_t>(constant.second.data.size()));
+        _ostream.write(reinterpret_cast<const char*>(constant.second.data.data()), constant.second.data.size());
+    }
+}
+
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
     : _istream(istream)
     , _cnn_network_builder(fn) {
@@ -152,10 +197,18 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        // the constants of the memory mapped blob (e.g. read from the model cache) are used without copy
+        auto sharedBuffer = dynamic_cast<SharedStreamBuffer*>(_istream.rdbuf());
+        if (sharedBuffer && hdr.consts_offset + hdr.consts_size <= sharedBuffer->size()) {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                desc, std::make_shared<MappedMemoryAllocator>(sharedBuffer->memory(), hdr.consts_offset));
+            dataBlob->allocate();
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -164,6 +217,7 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
 
     network = _cnn_network_builder(xmlString, std::move(dataBlob));
+    _networkEnd = _istream.tellg();
 
     // Set input and output precisions
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
@@ -174,5 +228,35 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+void CNNNetworkDeserializer::operator >> (PrecomputedConstants & constants) {
+    constants.clear();
+    _istream.seekg(_networkEnd);
+
+    char magic[sizeof constantsMagic] = {};
+    uint32_t version = 0;
+    int32_t isa = 0;
+    uint64_t count = 0;
+    // blobs exported by the previous versions have no constants
+    if (!_istream.read(magic, sizeof magic) || std::memcmp(magic, constantsMagic, sizeof magic) != 0 ||
+        !read(_istream, version) || version != constantsVersion ||
+        !read(_istream, isa) || isa != static_cast<int32_t>(dnnl::get_effective_cpu_isa()) ||
+        !read(_istream, count)) {
+        _istream.clear();
+        return;
+    }
+
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name;
+        PrecomputedConstant constant;
+        uint64_t size = 0;
+        if (!read(_istream, name) || !read(_istream, constant.signature) || !read(_istream, size))
+            IE_THROW(NetworkNotRead) << "The precomputed constants are invalid.";
+        constant.data.resize(size);
+        if (!_istream.read(reinterpret_cast<char*>(constant.data.data()), size))
+            IE_THROW(NetworkNotRead) << "The precomputed constants are invalid.";
+        constants.emplace(std::move(name), std::move(constant));
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
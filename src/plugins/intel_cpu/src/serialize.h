@@ -3,6 +3,7 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "graph.h"
 
 #include <iostream>
 #include <functional>
@@ -15,6 +16,8 @@ class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
     void operator << (const InferenceEngine::CNNNetwork & network);
+    // must follow the network
+    void operator << (const PrecomputedConstants & constants);
 
 private:
     std::ostream & _ostream;
@@ -29,10 +32,13 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    // must follow the network, the constants are left empty if the stream has none (or they are not applicable)
+    void operator >> (PrecomputedConstants & constants);
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::streampos _networkEnd = 0;
 };
 
 // const std::string& model, const Blob::CPtr& weights
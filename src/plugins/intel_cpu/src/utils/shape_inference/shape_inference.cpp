@@ -12,6 +12,8 @@
 #include <openvino/opsets/opset6.hpp>
 #include <openvino/opsets/opset7.hpp>
 #include <openvino/opsets/opset8.hpp>
+#include <openvino/op/irdft.hpp>
+#include <openvino/op/rdft.hpp>
 
 #include "assign_shape_inference.hpp"
 #include "bucketize_shape_inference.hpp"
@@ -35,8 +37,10 @@
 #include "gather_shape_inference.hpp"
 #include "gather_tree_shape_inference.hpp"
 #include "interpolate_shape_inference.hpp"
+#include "irdft_shape_inference.hpp"
 #include "lstm_cell_shape_inference.hpp"
 #include "one_hot_shape_inference.hpp"
+#include "rdft_shape_inference.hpp"
 #include "read_value_shape_inference.hpp"
 #include "reduce_shape_inference.hpp"
 #include "reverse_sequence_shape_inference.hpp"
@@ -510,6 +514,10 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset7::IDFT>(op)) {
         return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::op::v9::RDFT>(op)) {
+        return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::op::v9::IRDFT>(op)) {
+        return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset6::CTCGreedyDecoderSeqLen>(op)) {
         return make_shared_entryIO(node);
     } else if (auto node = ov::as_type_ptr<ov::opset6::CTCGreedyDecoder>(op)) {
@@ -14,6 +14,12 @@ std::ostream& operator<<(std::ostream& str, const StaticDimension& dimension) {
 StaticDimension::StaticDimension(value_type dimension)
         : m_dimension(dimension) {}
 
+StaticDimension::StaticDimension(value_type ldimension, value_type udimension)
+        : m_dimension(ldimension) {
+    OPENVINO_ASSERT(ldimension == udimension,
+                    "[shape infer] Cannot construct static dimension from the interval [", ldimension, ", ", udimension, "]");
+}
+
 bool StaticDimension::operator==(const StaticDimension& dim) const {
     return m_dimension == dim.m_dimension;
 }
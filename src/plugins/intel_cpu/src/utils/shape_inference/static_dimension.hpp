@@ -27,6 +27,11 @@ public:
     /// \param dimension Value of the dimension.
     StaticDimension(value_type dimension);
 
+    /// \brief Construct a static dimension from the interval, the bounds must be equal.
+    /// \param ldimension Lower bound of the dimension.
+    /// \param udimension Upper bound of the dimension.
+    StaticDimension(value_type ldimension, value_type udimension);
+
     /// \brief Construct a zero dimension
     StaticDimension() = default;
 
@@ -5,11 +5,31 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
+#include <openvino/util/xxhash.hpp>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
+constexpr size_t SimpleDataHash::kChunkSize;
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return ov::util::xxhash64(data, size, 0);
+
+    const size_t chunksNum = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = ov::util::xxhash64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+
+    return ov::util::xxhash64(chunkHashes.data(), chunkHashes.size() * sizeof(uint64_t), static_cast<uint64_t>(size));
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -23,28 +23,16 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * Non-cryptographic 64-bit hash of the data content (xxHash64 algorithm), is used to build the weights sharing keys.
+ * Big buffers are split into fixed size chunks which are hashed in parallel, then the hashes of the chunks
+ * are hashed together. So the result doesn't depend on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr size_t kChunkSize = 256 * 1024;
 };
 
 /**
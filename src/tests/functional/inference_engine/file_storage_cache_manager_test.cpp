@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "ie_cache_manager.hpp"
+#include "ie_shared_stream_buffer.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+class FileStorageCacheManagerTests : public ::testing::Test {
+protected:
+    std::string m_cacheDir = ::testing::UnitTest::GetInstance()->current_test_info()->name() + std::string("_cache");
+    std::shared_ptr<ICacheManager> m_cacheManager;
+
+    void SetUp() override {
+        CommonTestUtils::createDirectory(m_cacheDir);
+        m_cacheManager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir));
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, canReadWrittenEntryFromMappedMemory) {
+    const std::string content = "cached network content";
+    m_cacheManager->writeCacheEntry("entry", [&](std::ostream& stream) {
+        stream << content;
+    });
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size(), 0);
+
+    bool isRead = false;
+    m_cacheManager->readCacheEntry("entry", [&](std::istream& stream) {
+        auto buffer = dynamic_cast<SharedStreamBuffer*>(stream.rdbuf());
+        ASSERT_NE(nullptr, buffer);
+        ASSERT_EQ(content.size(), buffer->size());
+        EXPECT_EQ(0, std::memcmp(content.data(), buffer->data(), content.size()));
+
+        stream.seekg(7);
+        EXPECT_EQ(7, stream.tellg());
+        std::string tail(content.size() - 7, ' ');
+        stream.read(&tail[0], tail.size());
+        EXPECT_EQ(content.substr(7), tail);
+
+        stream.seekg(-7, std::ios_base::end);
+        std::string word;
+        stream >> word;
+        EXPECT_EQ("content", word);
+        isRead = true;
+    });
+    EXPECT_TRUE(isRead);
+}
+
+TEST_F(FileStorageCacheManagerTests, failedWriteDoesNotCreateEntry) {
+    EXPECT_THROW(m_cacheManager->writeCacheEntry("entry",
+                                                 [&](std::ostream& stream) {
+                                                     stream << "partial content";
+                                                     throw std::runtime_error("export failed");
+                                                 }),
+                 std::runtime_error);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 0);
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size(), 0);
+
+    bool isRead = false;
+    m_cacheManager->readCacheEntry("entry", [&](std::istream&) {
+        isRead = true;
+    });
+    EXPECT_FALSE(isRead);
+}
+
+TEST_F(FileStorageCacheManagerTests, canReplaceEntry) {
+    m_cacheManager->writeCacheEntry("entry", [&](std::ostream& stream) {
+        stream << "old content";
+    });
+    m_cacheManager->writeCacheEntry("entry", [&](std::ostream& stream) {
+        stream << "new";
+    });
+    EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+
+    m_cacheManager->readCacheEntry("entry", [&](std::istream& stream) {
+        std::string content;
+        stream >> content;
+        EXPECT_EQ("new", content);
+        EXPECT_TRUE(stream.eof());
+    });
+}
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+
+#include "openvino/util/mmap_object.hpp"
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/core.hpp>
+
+using namespace ::testing;
+using namespace std;
+
+class MmapObjectOVTests : public ::testing::Test {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::string m_file_path = test_name + ".bin";
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + "_model.bin";
+
+    void TearDown() override {
+        std::remove(m_file_path.c_str());
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    std::shared_ptr<ov::Model> make_model() {
+        auto a = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 64});
+        std::vector<float> values(2 * 64);
+        for (size_t i = 0; i < values.size(); i++)
+            values[i] = static_cast<float>(i) * 0.5f;
+        auto b = ov::opset8::Constant::create(ov::element::f32, ov::Shape{2, 64}, values);
+        auto add = std::make_shared<ov::opset8::Add>(a, b);
+        auto res = std::make_shared<ov::opset8::Result>(add);
+        return std::make_shared<ov::Model>(ov::NodeVector{res}, ov::ParameterVector{a});
+    }
+
+    std::shared_ptr<ov::opset8::Constant> get_constant(const std::shared_ptr<ov::Model>& model) {
+        for (const auto& op : model->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(op))
+                return constant;
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(MmapObjectOVTests, canMapFile) {
+    const std::string content = "mapped file content";
+    {
+        std::ofstream file(m_file_path, std::ios::binary);
+        file << content;
+    }
+
+    auto mapped_memory = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(nullptr, mapped_memory);
+    ASSERT_EQ(content.size(), mapped_memory->size());
+    EXPECT_EQ(0, std::memcmp(content.data(), mapped_memory->data(), content.size()));
+}
+
+TEST_F(MmapObjectOVTests, canMapEmptyFile) {
+    { std::ofstream file(m_file_path, std::ios::binary); }
+
+    auto mapped_memory = ov::util::load_mmap_object(m_file_path);
+    ASSERT_NE(nullptr, mapped_memory);
+    EXPECT_EQ(0u, mapped_memory->size());
+}
+
+TEST_F(MmapObjectOVTests, throwIfNoFile) {
+    EXPECT_THROW(ov::util::load_mmap_object("wrong_name.bin"), std::runtime_error);
+}
+
+TEST_F(MmapObjectOVTests, readModelWithMappedWeights) {
+    auto model = make_model();
+    ov::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(model);
+
+    ov::Core core;
+    core.set_property(ov::enable_mmap(true));
+    auto mapped_model = core.read_model(m_out_xml_path, m_out_bin_path);
+    core.set_property(ov::enable_mmap(false));
+    auto read_model = core.read_model(m_out_xml_path, m_out_bin_path);
+
+    auto expected = get_constant(model);
+    auto mapped = get_constant(mapped_model);
+    auto read = get_constant(read_model);
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_NE(nullptr, read);
+    EXPECT_EQ(expected->get_vector<float>(), mapped->get_vector<float>());
+    EXPECT_EQ(expected->get_vector<float>(), read->get_vector<float>());
+}
@@ -0,0 +1,138 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset6.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/assign_registers.hpp>
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <snippets/pass/decompose_reductions.hpp>
+#include <snippets/op/subgraph.hpp>
+
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+std::shared_ptr<Function> decompose(const std::shared_ptr<Node>& normalization, const ParameterVector& params) {
+    auto f = std::make_shared<Function>(NodeVector{normalization}, params);
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<snippets::pass::DecomposeReductions>();
+    m.run_passes(f);
+    return f;
+}
+} // namespace
+
+TEST(TransformationTests, DecomposeSoftmax) {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+    auto softmax = std::make_shared<opset1::Softmax>(data, 2);
+    auto f = decompose(softmax, {data});
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(count_ops_of_type<opset1::Softmax>(f), 0);
+    ASSERT_EQ(count_ops_of_type<snippets::op::Reduce>(f), 2);
+    ASSERT_EQ(count_ops_of_type<opset1::Exp>(f), 1);
+    ASSERT_EQ(f->get_output_shape(0), (Shape{2, 3, 16}));
+}
+
+TEST(TransformationTests, DecomposeMVN) {
+    for (bool normalize_variance : {true, false}) {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+        auto axes = opset1::Constant::create(element::i64, Shape{1}, {-1});
+        auto mvn = std::make_shared<opset6::MVN>(data, axes, normalize_variance, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+        auto f = decompose(mvn, {data});
+        ASSERT_NO_THROW(check_rt_info(f));
+
+        ASSERT_EQ(count_ops_of_type<opset6::MVN>(f), 0);
+        ASSERT_EQ(count_ops_of_type<snippets::op::Reduce>(f), normalize_variance ? 2 : 1);
+        ASSERT_EQ(f->get_output_shape(0), (Shape{2, 3, 16}));
+    }
+}
+
+TEST(TransformationTests, DoNotDecomposeNotInnermostReduction) {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3, 16});
+    auto softmax = std::make_shared<opset1::Softmax>(data, 1);
+    ASSERT_FALSE(snippets::pass::DecomposeReductions::is_supported(softmax));
+
+    auto f = decompose(softmax, {data});
+    ASSERT_EQ(count_ops_of_type<opset1::Softmax>(f), 1);
+    ASSERT_EQ(count_ops_of_type<snippets::op::Reduce>(f), 0);
+}
+
+TEST(TransformationTests, TokenizeSoftmaxSubgraph) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto data0 = std::make_shared<opset1::Parameter>(element::i32, Shape{2, 3, 16});
+    auto data1 = std::make_shared<opset1::Parameter>(element::i32, Shape{1, 1, 16});
+    auto convert0 = std::make_shared<opset1::Convert>(data0, element::f32);
+    auto convert1 = std::make_shared<opset1::Convert>(data1, element::f32);
+    auto add = std::make_shared<opset1::Add>(convert0, convert1);
+    auto softmax = std::make_shared<opset1::Softmax>(add, 2);
+    auto mul = std::make_shared<opset1::Multiply>(softmax, convert1);
+    auto f = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+
+    pass::Manager m;
+    m.register_pass<pass::InitNodeInfo>();
+    m.register_pass<snippets::pass::EnumerateNodes>();
+    m.register_pass<snippets::pass::TokenizeSnippets>();
+    m.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    ASSERT_EQ(count_ops_of_type<snippets::op::Subgraph>(f), 1);
+    ASSERT_EQ(count_ops_of_type<opset1::Softmax>(f), 0);
+    for (const auto& op : f->get_ops()) {
+        if (auto subgraph = ov::as_type_ptr<snippets::op::Subgraph>(op)) {
+            ASSERT_TRUE(subgraph->has_reductions());
+            ASSERT_EQ(count_ops_of_type<opset1::Softmax>(subgraph->get_body()), 1);
+        }
+    }
+}
+
+TEST(TransformationTests, AssignRegistersReduce) {
+    std::shared_ptr<Function> f(nullptr);
+    {
+        auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 16});
+        auto y00 = std::make_shared<snippets::isa::Load>(p0); y00->set_friendly_name("y00");
+        auto y01 = std::make_shared<snippets::op::Reduce>(y00, snippets::op::Reduce::Kind::Max); y01->set_friendly_name("y01");
+        auto y02 = std::make_shared<snippets::isa::BroadcastMove>(y01, Shape{1, 16}); y02->set_friendly_name("y02");
+        auto y03 = std::make_shared<opset1::Subtract>(y00, y02); y03->set_friendly_name("y03");
+        auto y04 = std::make_shared<snippets::isa::Store>(y03); y04->set_friendly_name("y04");
+
+        f = std::make_shared<Function>(NodeVector{y04}, ParameterVector{p0});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::AssignRegisters>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    // the reduction result has to survive the next passes over the row, so it gets a register
+    // reserved from the end of the bank, the rest of the registers are assigned as usual
+    {
+        std::map<std::string, size_t> ref_registers {
+            {"y00", 0},
+            {"y01", 15},
+            {"y02", 1},
+            {"y03", 2}
+        };
+
+        for (auto& op : f->get_ordered_ops()) {
+            auto& rt = op->get_rt_info();
+            auto it_rinfo = rt.find("reginfo");
+            if (it_rinfo != rt.end() && ref_registers.count(op->get_friendly_name())) {
+                auto reginfo = it_rinfo->second.as<std::vector<size_t>>();
+                ASSERT_EQ(ref_registers[op->get_friendly_name()], reginfo[0]) << op->get_friendly_name();
+            }
+        }
+    }
+}
@@ -285,3 +285,27 @@ TEST(TransformationTests, DontAttachToSubgraphIfLoop) {
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, TokenizeDynamicShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    std::shared_ptr<Model> f(nullptr);
+    {
+        auto data0 = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1, -1, 3});
+        auto data1 = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1, 1, 3});
+        auto convert0 = std::make_shared<op::v0::Convert>(data0, element::f32);
+        auto convert1 = std::make_shared<op::v0::Convert>(data1, element::f32);
+        auto add = std::make_shared<op::v1::Add>(convert0, convert1);
+        auto sub = std::make_shared<op::v1::Subtract>(add, convert1);
+        // a dynamic subgraph has a single output, so the chain has no intermediate consumers
+        auto mul = std::make_shared<op::v1::Multiply>(sub, convert0);
+        f = std::make_shared<Model>(NodeVector{mul}, ParameterVector{data0, data1});
+        pass::Manager m;
+        m.register_pass<InitNodeInfo>();
+        m.register_pass<EnumerateNodes>();
+        m.register_pass<TokenizeSnippets>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    ASSERT_EQ(count_ops_of_type<Subgraph>(f), 1);
+    ASSERT_EQ(f->get_output_partial_shape(0), (PartialShape{-1, -1, 3}));
+}
@@ -16,6 +16,7 @@
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset8.hpp>
 #include <transformations/convert_precision.hpp>
+#include <transformations/rt_info/keep_const_precision.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
@@ -250,6 +251,35 @@ TEST(TransformationTests, ConvertPrecision_ConstantRelu) {
     ASSERT_FALSE(has_type<ngraph::element::Type_t::f16>(f));
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Function> f(nullptr);
+    std::shared_ptr<opset4::Constant> weights;
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f16, Shape{1, 16});
+        weights = opset4::Constant::create(element::f16, Shape{16, 16}, {1});
+        ov::enable_keep_const_precision(weights);
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto input_convert = std::make_shared<opset4::Convert>(input, element::f32);
+        auto matmul = std::make_shared<opset4::MatMul>(input_convert, convert);
+
+        f = std::make_shared<Function>(NodeVector{matmul}, ParameterVector{input});
+
+        pass::Manager manager;
+
+        static const precisions_array precisions = {
+                { ngraph::element::f16, ngraph::element::f32 }
+        };
+
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions);
+        manager.run_passes(f);
+    }
+
+    // only the marked Constant keeps the original precision
+    ASSERT_EQ(f->get_parameters().front()->get_element_type(), element::f32);
+    ASSERT_EQ(weights->output(0).get_target_inputs().size(), 1);
+    ASSERT_EQ(weights->get_element_type(), element::f16);
+}
+
 TEST(TransformationTests, ConvertPrecision_Convert) {
     std::shared_ptr<Function> f(nullptr);
     {
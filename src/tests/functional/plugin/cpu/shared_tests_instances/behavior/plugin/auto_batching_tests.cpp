@@ -5,7 +5,7 @@
 
 const std::vector<bool>   get_vs_set{ true, false };
 const std::vector<size_t> num_streams{ 1, 2 };
-const std::vector<size_t> num_requests{ 1, 3, 8, 9, 16, 64 };
+const std::vector<size_t> num_requests{ 1, 3, 5, 8, 9, 16, 64 };
 const std::vector<size_t> num_batch{ 1, 4, 8, 16, 32, 64, 128, 256 };
 using namespace AutoBatchingTests;
 
@@ -18,6 +18,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
                 ::testing::ValuesIn(num_requests),
                 ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test::getTestCaseName);
+
+// not filled batches: 2 of 4 (the rest of 6 requests) and 3 of 8 execute as the partial batches of 2 and 4,
+// while 3 of 4 and 6 of 8 fall back to batch1
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_PartialBatch,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(get_vs_set),
+                ::testing::Values(1),
+                ::testing::Values(3, 6),
+                ::testing::Values(4, 8)),
+                         AutoBatching_Test_PartialBatch::getTestCaseName);
 // TODO: for 22.2 (CVS-68949)
 //INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_DetectionOutput,
 //                         ::testing::Combine(
@@ -26,6 +26,14 @@ INSTANTIATE_TEST_SUITE_P(nightly_RandomMajorNodes, HeteroSyntheticTest,
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_randomMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
 
+#ifdef TEMPLATE_PLUGIN_ENABLED
+INSTANTIATE_TEST_SUITE_P(smoke_SingleMajorNode_CPU_TEMPLATE, HeteroSyntheticTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "openvino_intel_cpu_plugin"}, {"TEMPLATE", "openvino_template_plugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_singleMajorNodeFunctions)),
+                        HeteroSyntheticTest::getTestCaseName);
+#endif // TEMPLATE_PLUGIN_ENABLED
+
 #endif // !OPENVINO_STATIC_LIBRARY
 
 }  // namespace
@@ -4,6 +4,7 @@
 
 #include <subgraph_tests/memory_LSTMCell.hpp>
 #include "common_test_utils/test_constants.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 namespace SubgraphTestsDefinitions {
     std::vector<ngraph::helpers::MemoryTransformation> transformation {
@@ -42,4 +43,18 @@ namespace SubgraphTestsDefinitions {
                                     ::testing::ValuesIn(hidden_sizes),
                                     ::testing::Values(additional_config)),
                             MemoryLSTMCellTest::getTestCaseName);
+
+    std::map<std::string, std::string> zero_copy_states_config = {
+            {CONFIG_KEY_INTERNAL(CPU_ZERO_COPY_STATES), InferenceEngine::PluginConfigParams::YES}
+    };
+
+    INSTANTIATE_TEST_SUITE_P(smoke_MemoryLSTMCellTest_ZeroCopyStates, MemoryLSTMCellTest,
+                            ::testing::Combine(
+                                    ::testing::ValuesIn(transformation),
+                                    ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                    ::testing::Values(InferenceEngine::Precision::FP32),
+                                    ::testing::ValuesIn(input_sizes),
+                                    ::testing::ValuesIn(hidden_sizes),
+                                    ::testing::Values(zero_copy_states_config)),
+                            MemoryLSTMCellTest::getTestCaseName);
 } // namespace SubgraphTestsDefinitions
@@ -0,0 +1,73 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+/* The batch of 1D signals of the given length is transformed along the innermost complex axis. The lengths cover
+   the mixed radix stages (2, 3, 4, 5) and the Bluestein algorithm for the other prime factors. */
+
+using DFTLengthsParams = std::tuple<size_t,                        // signal length
+                                    size_t,                        // batch
+                                    ngraph::helpers::DFTOpType>;   // forward or inverse
+
+class DFTLengthsCPUTest : public testing::WithParamInterface<DFTLengthsParams>,
+                          virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DFTLengthsParams>& obj) {
+        size_t length, batch;
+        ngraph::helpers::DFTOpType opType;
+        std::tie(length, batch, opType) = obj.param;
+
+        std::ostringstream result;
+        result << "N=" << length << "_";
+        result << "batch=" << batch << "_";
+        result << (opType == ngraph::helpers::DFTOpType::INVERSE ? "IDFT" : "DFT");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        size_t length, batch;
+        ngraph::helpers::DFTOpType opType;
+        std::tie(length, batch, opType) = this->GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{batch, length, 2}}));
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto dft = ngraph::builder::makeDFT(params[0], {1}, {}, opType);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{dft}, params, "DFTLengths");
+    }
+};
+
+TEST_P(DFTLengthsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+namespace {
+
+const std::vector<ngraph::helpers::DFTOpType> opTypes = {
+    ngraph::helpers::DFTOpType::FORWARD,
+    ngraph::helpers::DFTOpType::INVERSE
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DFTLengths_CPU, DFTLengthsCPUTest,
+                         ::testing::Combine(::testing::Values(1, 6, 13, 64, 400, 480, 1021),
+                                            ::testing::Values(1, 3),
+                                            ::testing::ValuesIn(opTypes)),
+                         DFTLengthsCPUTest::getTestCaseName);
+
+} // namespace
+
+}  // namespace CPULayerTestsDefinitions
@@ -406,6 +406,41 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommon, LoopLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the static body moves the merged input by the exchange of the buffers
+std::vector<std::vector<InputShape>> inputs_static = {
+    {
+        {{5, 1, 3}, {{5, 1, 3}}},
+        {{5, 1, 3}, {{5, 1, 3}}},
+        {{5, 1, 3}, {{5, 1, 3}}}
+    },
+    {
+        {{1, 1, 64}, {{1, 1, 64}}},
+        {{1, 1, 64}, {{1, 1, 64}}},
+        {{1, 1, 64}, {{1, 1, 64}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommonStatic, LoopLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(trip_count_type[0]),
+                                 ::testing::Values(1, 2, 5, 100),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs_static),
+                                 ::testing::Values(types),
+                                 ::testing::Values(ElementType::f32)),
+                         LoopLayerCPUTest::getTestCaseName);
+
+// the dynamic loop concatenates the outputs of many iterations
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForCommonLong, LoopLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(trip_count_type[0]),
+                                 ::testing::Values(100),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs),
+                                 ::testing::Values(types),
+                                 ::testing::Values(ElementType::f32)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 std::vector<std::vector<InputShape>> inputs_2 = {
     {  //first test suit
         {   //dynamic shape
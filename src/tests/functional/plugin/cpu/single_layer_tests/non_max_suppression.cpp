@@ -436,4 +436,28 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// the number of candidates per class above the threshold of the blocked hard NMS
+const std::vector<InputShapeParams> largeInShapeParams = {
+    InputShapeParams{std::vector<ov::Dimension>{}, std::vector<TargetShapeParams>{TargetShapeParams{1, 10000, 1}}},
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{2, 8000, 2},
+                                                                                            TargetShapeParams{1, 100, 1}}}
+};
+
+const auto largeNmsParams = ::testing::Combine(::testing::ValuesIn(largeInShapeParams),
+                                               ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                  ::testing::Values(ElementType::i32),
+                                                                  ::testing::Values(ElementType::f32)),
+                                               ::testing::Values(20, 1000),
+                                               ::testing::Combine(::testing::ValuesIn(threshold),
+                                                                  ::testing::Values(0.3f),
+                                                                  ::testing::Values(0.0f)),
+                                               ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                               ::testing::ValuesIn(encodType),
+                                               ::testing::Values(true),
+                                               ::testing::Values(element::i32),
+                                               ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_LargeCandidates, NmsLayerCPUTest, largeNmsParams, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,219 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_tensor_utils.hpp"
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/op/irdft.hpp>
+#include <openvino/op/rdft.hpp>
+
+#include <limits>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+/* RDFT and IRDFT have no reference implementation, so the reference model is built for every target shape of the
+   complex DFT/IDFT:
+     RDFT:  the real input padded with the zero imaginary parts -> DFT -> the first N / 2 + 1 values of the last axis
+     IRDFT: IDFT of all the axes except the last one -> the Hermitian symmetric extension of the last axis -> IDFT of
+            the last axis -> the real parts */
+
+using RDFTParams = std::tuple<InputShape,              // data shape, the complex input of IRDFT has the trailing 2
+                              std::vector<int64_t>,    // axes
+                              std::vector<int64_t>,    // signal size
+                              bool>;                   // inverse
+
+class RDFTLayerCPUTest : public testing::WithParamInterface<RDFTParams>,
+                         virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RDFTParams>& obj) {
+        InputShape inputShape;
+        std::vector<int64_t> axes, signalSize;
+        bool inverse;
+        std::tie(inputShape, axes, signalSize, inverse) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "axes=" << CommonTestUtils::vec2str(axes) << "_";
+        result << "signalSize=" << CommonTestUtils::vec2str(signalSize) << "_";
+        result << (inverse ? "IRDFT" : "RDFT");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        std::tie(inputShape, axes, signalSize, inverse) = this->GetParam();
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        params.front()->set_friendly_name("data");
+        auto axesNode = ov::opset8::Constant::create(ov::element::i64, {axes.size()}, axes);
+        std::shared_ptr<ov::Node> rdft;
+        if (signalSize.empty()) {
+            rdft = inverse ? std::shared_ptr<ov::Node>(std::make_shared<ov::op::v9::IRDFT>(params.front(), axesNode))
+                           : std::make_shared<ov::op::v9::RDFT>(params.front(), axesNode);
+        } else {
+            auto signalSizeNode = ov::opset8::Constant::create(ov::element::i64, {signalSize.size()}, signalSize);
+            rdft = inverse ? std::shared_ptr<ov::Node>(std::make_shared<ov::op::v9::IRDFT>(params.front(), axesNode, signalSizeNode))
+                           : std::make_shared<ov::op::v9::RDFT>(params.front(), axesNode, signalSizeNode);
+        }
+        function = std::make_shared<ov::Model>(ov::NodeVector{rdft}, params, "RDFT");
+        functionRefs = createReference(targetStaticShapes.front().front());
+    }
+
+    void init_ref_function(std::shared_ptr<ov::Model>& funcRef, const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        funcRef = createReference(targetInputStaticShapes.front());
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs().front();
+        inputs.insert({funcInput.get_node_shared_ptr(),
+                       ov::test::utils::create_and_fill_tensor(ov::element::f32, targetInputStaticShapes.front(), 2, -1, 32)});
+    }
+
+    std::shared_ptr<ov::Model> createReference(const ov::Shape& shape) const {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        param->set_friendly_name("data");
+
+        const auto realRank = static_cast<int64_t>(inverse ? shape.size() - 1 : shape.size());
+        std::vector<int64_t> normalizedAxes;
+        std::vector<int64_t> signalSizes;
+        for (size_t i = 0; i < axes.size(); i++) {
+            const int64_t axis = axes[i] < 0 ? axes[i] + realRank : axes[i];
+            const bool isLast = i + 1 == axes.size();
+            int64_t size = static_cast<int64_t>(shape[axis]);
+            if (inverse && isLast)
+                size = 2 * (size - 1);
+            if (!signalSize.empty() && signalSize[i] != -1)
+                size = signalSize[i];
+            normalizedAxes.push_back(axis);
+            signalSizes.push_back(size);
+        }
+        const int64_t lastAxis = normalizedAxes.back();
+        const int64_t lastSize = signalSizes.back();
+        const int64_t halfSize = lastSize / 2 + 1;
+
+        std::shared_ptr<ov::Node> result;
+        if (!inverse) {
+            auto complex = std::make_shared<ov::opset8::Unsqueeze>(param, ov::opset8::Constant::create(ov::element::i64, {1}, {-1}));
+            std::vector<int64_t> padsEnd(shape.size() + 1, 0);
+            padsEnd.back() = 1;
+            auto padded = std::make_shared<ov::opset8::Pad>(complex,
+                                                            ov::opset8::Constant::create(ov::element::i64, {padsEnd.size()}, std::vector<int64_t>(padsEnd.size(), 0)),
+                                                            ov::opset8::Constant::create(ov::element::i64, {padsEnd.size()}, padsEnd),
+                                                            ov::op::PadMode::CONSTANT);
+            auto dft = ngraph::builder::makeDFT(padded, normalizedAxes, signalSizes, ngraph::helpers::DFTOpType::FORWARD);
+            result = ngraph::builder::makeSlice(dft, {0}, {halfSize}, {1}, {lastAxis}, ov::element::i64);
+        } else {
+            // the last axis is cropped or padded to the non-redundant half of the spectrum
+            std::shared_ptr<ov::Node> spectrum = param;
+            const auto inputSize = static_cast<int64_t>(shape[lastAxis]);
+            if (inputSize > halfSize) {
+                spectrum = ngraph::builder::makeSlice(spectrum, {0}, {halfSize}, {1}, {lastAxis}, ov::element::i64);
+            } else if (inputSize < halfSize) {
+                std::vector<int64_t> padsEnd(shape.size(), 0);
+                padsEnd[lastAxis] = halfSize - inputSize;
+                spectrum = std::make_shared<ov::opset8::Pad>(spectrum,
+                                                             ov::opset8::Constant::create(ov::element::i64, {padsEnd.size()}, std::vector<int64_t>(padsEnd.size(), 0)),
+                                                             ov::opset8::Constant::create(ov::element::i64, {padsEnd.size()}, padsEnd),
+                                                             ov::op::PadMode::CONSTANT);
+            }
+            if (normalizedAxes.size() > 1) {
+                spectrum = ngraph::builder::makeDFT(spectrum,
+                                                    std::vector<int64_t>(normalizedAxes.begin(), normalizedAxes.end() - 1),
+                                                    std::vector<int64_t>(signalSizes.begin(), signalSizes.end() - 1),
+                                                    ngraph::helpers::DFTOpType::INVERSE);
+            }
+            // X[N - k] = conj(X[k]) for k in [1, N - N / 2)
+            if (lastSize - halfSize > 0) {
+                auto tail = ngraph::builder::makeSlice(spectrum, {1}, {lastSize - halfSize + 1}, {1}, {lastAxis}, ov::element::i64);
+                auto reversed = ngraph::builder::makeSlice(tail, {-1}, {std::numeric_limits<int64_t>::min()}, {-1}, {lastAxis}, ov::element::i64);
+                auto conjugated = std::make_shared<ov::opset8::Multiply>(reversed, ov::opset8::Constant::create(ov::element::f32, {2}, {1.f, -1.f}));
+                spectrum = std::make_shared<ov::opset8::Concat>(ov::OutputVector{spectrum, conjugated}, lastAxis);
+            }
+            auto idft = ngraph::builder::makeDFT(spectrum, {lastAxis}, {}, ngraph::helpers::DFTOpType::INVERSE);
+            auto real = ngraph::builder::makeSlice(idft, {0}, {1}, {1}, {realRank}, ov::element::i64);
+            result = std::make_shared<ov::opset8::Squeeze>(real, ov::opset8::Constant::create(ov::element::i64, {1}, {realRank}));
+        }
+        return std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{param}, "RDFTReference");
+    }
+
+    std::vector<int64_t> axes;
+    std::vector<int64_t> signalSize;
+    bool inverse = false;
+};
+
+TEST_P(RDFTLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "RDFT", 1);
+}
+
+namespace {
+
+const std::vector<InputShape> realShapes = {
+    {{}, {{2, 3, 64}}},
+    {{}, {{3, 5, 13}}},
+    {{-1, -1, 10}, {{1, 4, 10}, {3, 7, 10}, {1, 4, 10}}},
+    {{{1, 4}, 6, {5, 50}}, {{2, 6, 48}, {4, 6, 5}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_RDFT_CPU_1D, RDFTLayerCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(realShapes),
+                                            ::testing::Values(std::vector<int64_t>{-1}),
+                                            ::testing::Values(std::vector<int64_t>{}, std::vector<int64_t>{7}, std::vector<int64_t>{16}),
+                                            ::testing::Values(false)),
+                         RDFTLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_RDFT_CPU_ND, RDFTLayerCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(realShapes),
+                                            ::testing::Values(std::vector<int64_t>{1, 2}, std::vector<int64_t>{2, 0}, std::vector<int64_t>{0, 1, 2}),
+                                            ::testing::Values(std::vector<int64_t>{}),
+                                            ::testing::Values(false)),
+                         RDFTLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_RDFT_CPU_SignalSize, RDFTLayerCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{3, 5, 13}}}),
+                                            ::testing::Values(std::vector<int64_t>{1, 2}),
+                                            ::testing::Values(std::vector<int64_t>{-1, 9}, std::vector<int64_t>{8, 20}),
+                                            ::testing::Values(false)),
+                         RDFTLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> complexShapes = {
+    {{}, {{2, 33, 2}}},
+    {{}, {{3, 5, 7, 2}}},
+    {{-1, -1, 6, 2}, {{1, 4, 6, 2}, {3, 7, 6, 2}, {1, 4, 6, 2}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_IRDFT_CPU_1D, RDFTLayerCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(complexShapes),
+                                            ::testing::Values(std::vector<int64_t>{-1}),
+                                            ::testing::Values(std::vector<int64_t>{}, std::vector<int64_t>{9}, std::vector<int64_t>{20}),
+                                            ::testing::Values(true)),
+                         RDFTLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_IRDFT_CPU_ND, RDFTLayerCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{3, 5, 7, 2}}},
+                                                              InputShape{{-1, -1, 6, 2}, {{1, 4, 6, 2}, {3, 7, 6, 2}}}),
+                                            ::testing::Values(std::vector<int64_t>{0, 2}, std::vector<int64_t>{2, 1}),
+                                            ::testing::Values(std::vector<int64_t>{}, std::vector<int64_t>{4, 11}),
+                                            ::testing::Values(true)),
+                         RDFTLayerCPUTest::getTestCaseName);
+
+} // namespace
+
+}  // namespace CPULayerTestsDefinitions
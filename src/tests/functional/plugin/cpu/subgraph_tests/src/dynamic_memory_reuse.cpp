@@ -0,0 +1,100 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The dynamic shape tensors are placed to the single memory arena. The chain of the fully connected layers has
+   four intermediate tensors of the same size, the first and the third ones (as well as the second and the fourth ones)
+   have disjoint lifetimes, so the peak is expected to be below the peak of the separate buffers (the reuse disabled).
+   The input shapes are repeated and changed to check both the reused and the updated memory solutions, the outputs
+   must be the same as without the reuse for every shape.
+
+       PARAM
+         |
+      MATMUL
+         |
+      MATMUL
+         |
+      MATMUL
+         |
+      MATMUL
+         |
+      MATMUL
+         |
+       RESULT
+*/
+
+class DynamicMemoryReuseTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_REUSE,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        const auto ngPrc = ov::element::f32;
+        InputShape inputShape{{-1, 32}, {{4, 32}, {16, 32}, {4, 32}, {16, 32}, {64, 32}, {4, 32}}};
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto fc = [&](const ov::Output<ov::Node>& in, size_t outChannels) {
+            const size_t inChannels = in.get_partial_shape()[1].get_length();
+            auto weights = ngraph::builder::makeConstant<float>(ngPrc, {inChannels, outChannels}, {}, true);
+            return std::make_shared<ov::op::v0::MatMul>(in, weights);
+        };
+
+        std::shared_ptr<ov::Node> output = fc(params[0], 64);
+        for (size_t i = 0; i < 3; i++)
+            output = fc(output, 64);
+        output = fc(output, 16);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{output}, params, "DynamicMemoryReuse");
+    }
+};
+
+TEST_F(DynamicMemoryReuseTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    auto noReuseConfiguration = configuration;
+    noReuseConfiguration[InferenceEngine::PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_REUSE] =
+        InferenceEngine::PluginConfigParams::NO;
+    auto noReuseModel = core->compile_model(function, targetDevice, noReuseConfiguration);
+    auto noReuseRequest = noReuseModel.create_infer_request();
+
+    for (const auto& targetStaticShape : targetStaticShapes) {
+        generate_inputs(targetStaticShape);
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+            noReuseRequest.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+        noReuseRequest.infer();
+
+        const auto output = inferRequest.get_output_tensor();
+        const auto expected = noReuseRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), expected.get_shape());
+        const auto outputData = output.data<const float>();
+        const auto expectedData = expected.data<const float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(outputData[i], expectedData[i]) << "shape " << targetStaticShape.front() << " at " << i;
+    }
+
+    const auto peak = compiledModel.get_property(InferenceEngine::PluginConfigInternalParams::METRIC_CPU_DYNAMIC_MEMORY_PEAK).as<uint64_t>();
+    const auto noReusePeak = noReuseModel.get_property(InferenceEngine::PluginConfigInternalParams::METRIC_CPU_DYNAMIC_MEMORY_PEAK).as<uint64_t>();
+    // the four intermediate tensors of the largest shape [64, 64] take 16KB each without the reuse
+    const uint64_t intermediateSize = 64 * 64 * sizeof(float);
+    ASSERT_GE(noReusePeak, 4 * intermediateSize);
+    ASSERT_GT(peak, 0u);
+    ASSERT_LT(peak, noReusePeak);
+}
+
+}  // namespace SubgraphTestsDefinitions
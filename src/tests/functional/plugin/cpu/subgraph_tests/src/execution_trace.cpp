@@ -0,0 +1,103 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The execution timeline is written to the file on the destruction of the compiled model. The spans of the nodes,
+   of the infer requests and of the async pipeline stages are expected.
+
+       PARAM
+         |
+      MATMUL
+         |
+       RELU
+         |
+      RESULT
+*/
+
+class ExecutionTraceTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_EXECUTION_TRACE, tracePath});
+
+        const auto ngPrc = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({ov::Shape{4, 32}}));
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {32, 16}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weights);
+        // the relu is fused into the matmul, which keeps its name
+        matMul->set_friendly_name("traced_matmul");
+        auto relu = std::make_shared<ov::op::v0::Relu>(matMul);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{relu}, params, "ExecutionTrace");
+    }
+
+    void TearDown() override {
+        std::remove(tracePath.c_str());
+    }
+
+    const std::string tracePath = "cpu_execution_trace_test.json";
+};
+
+TEST_F(ExecutionTraceTest, smoke_WritesChromeTrace) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    auto asyncRequest = compiledModel.create_infer_request();
+    for (const auto& input : inputs)
+        asyncRequest.set_tensor(input.first, input.second);
+    asyncRequest.start_async();
+    asyncRequest.wait();
+
+    asyncRequest = {};
+    inferRequest = {};
+    compiledModel = {};
+
+    std::ifstream file(tracePath);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream trace;
+    trace << file.rdbuf();
+    const auto content = trace.str();
+
+    ASSERT_EQ(content.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+    ASSERT_NE(content.find("\"name\":\"traced_matmul\",\"cat\":\"node\""), std::string::npos);
+    ASSERT_NE(content.find("\"name\":\"Infer request\",\"cat\":\"infer_request\""), std::string::npos);
+    ASSERT_NE(content.find("\"name\":\"Pipeline stage\",\"cat\":\"pipeline_stage\""), std::string::npos);
+    ASSERT_NE(content.find("\"name\":\"Stream 0 runtime cache\",\"cat\":\"runtime_cache\""), std::string::npos);
+}
+
+TEST_F(ExecutionTraceTest, smoke_WritesSharedRuntimeCacheStatistics) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration.insert({InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"});
+    run();
+
+    inferRequest = {};
+    compiledModel = {};
+
+    std::ifstream file(tracePath);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream trace;
+    trace << file.rdbuf();
+    const auto content = trace.str();
+
+    ASSERT_NE(content.find("\"name\":\"Shared runtime cache\",\"cat\":\"runtime_cache\""), std::string::npos);
+    ASSERT_NE(content.find("\"name\":\"Stream 1 runtime cache\",\"cat\":\"runtime_cache\""), std::string::npos);
+}
+
+}  // namespace SubgraphTestsDefinitions
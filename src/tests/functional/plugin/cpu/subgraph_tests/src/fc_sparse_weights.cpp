@@ -0,0 +1,120 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The FullyConnected with the weights containing the given fraction of zeros. The sparse weights kernel is used
+   if the fraction is not less than CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, otherwise the dense one.
+
+        PARAM
+          |
+       MATMUL (weights, transpose_b)
+          |
+        RESULT
+*/
+
+using FCSparseWeightsParams = std::tuple<InputShape,  // input shape
+                                         size_t,      // output channels
+                                         float,       // weights sparse rate
+                                         float>;      // decompression rate
+
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsParams>,
+                            virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCSparseWeightsParams>& obj) {
+        InputShape inputShape;
+        size_t outChannels;
+        float sparseRate, decompressionRate;
+        std::tie(inputShape, outChannels, sparseRate, decompressionRate) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "OC=" << outChannels << "_";
+        result << "sparseRate=" << sparseRate << "_";
+        result << "decompressionRate=" << decompressionRate;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t outChannels;
+        float sparseRate, decompressionRate;
+        std::tie(inputShape, outChannels, sparseRate, decompressionRate) = this->GetParam();
+        expectSparse = decompressionRate < 1.f && sparseRate >= decompressionRate;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE,
+                              std::to_string(decompressionRate)});
+
+        const auto ngPrc = ov::element::f32;
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        const size_t inChannels = inputDynamicShapes.front().rbegin()->get_length();
+        std::vector<float> weightsData(outChannels * inChannels);
+        const size_t zerosPerHundred = static_cast<size_t>(sparseRate * 100);
+        for (size_t i = 0; i < weightsData.size(); i++) {
+            // spread the zeros uniformly over the weights
+            weightsData[i] = (i * 37) % 100 < zerosPerHundred ? 0.f : static_cast<float>(i % 17) / 8.f - 1.f;
+        }
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {outChannels, inChannels}, weightsData);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weights, false, true);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{matMul}, params, "FCSparseWeights");
+    }
+
+    void checkPrimitiveType() {
+        auto runtimeModel = compiledModel.get_runtime_model();
+        for (const auto& node : runtimeModel->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto primitiveType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            ASSERT_EQ(expectSparse, primitiveType == "ref_sparse") << primitiveType;
+        }
+    }
+
+    bool expectSparse = false;
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    checkPrimitiveType();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 512}}},
+    {{}, {{2, 16, 256}}},
+    {{-1, 512}, {{1, 512}, {7, 512}, {1, 512}, {33, 512}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCSparseWeights, FCSparseWeightsTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(64, 77),
+                                            ::testing::Values(0.f, 0.5f, 0.9f),
+                                            ::testing::Values(0.7f, 1.f)),
+                         FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,180 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The compressed weights are decompressed by the FullyConnected on the fly, so neither Convert nor elementwise
+   operations are executed and the weights are kept in the original precision. It's done for the memory bound
+   FullyConnected only (a few activations rows) with CPU_FC_WEIGHTS_DECOMPRESSION enabled, otherwise the weights
+   are folded to f32.
+
+    Const (u8, i8 or f16)   Const (zero points)
+            |                     |
+         CONVERT               CONVERT
+             \                   /
+              SUBTRACT (optional)
+                     |
+                 MULTIPLY (scales)
+                     |
+        PARAM      (weights)
+           \        /
+             MATMUL
+               |
+             RESULT
+*/
+
+using FCWeightsDecompressionParams = std::tuple<InputShape,          // input shape
+                                                size_t,              // output channels
+                                                ov::element::Type,   // weights precision
+                                                bool,                // transpose weights
+                                                bool,                // with zero points
+                                                bool>;               // CPU_FC_WEIGHTS_DECOMPRESSION
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCWeightsDecompressionParams>& obj) {
+        InputShape inputShape;
+        size_t outChannels;
+        ov::element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints, enableDecompression;
+        std::tie(inputShape, outChannels, weightsPrecision, transposeWeights, withZeroPoints, enableDecompression) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << CommonTestUtils::vec2str(shape) << "_";
+        }
+        result << "OC=" << outChannels << "_";
+        result << "WP=" << weightsPrecision << "_";
+        result << "transpose=" << transposeWeights << "_";
+        result << "zeroPoints=" << withZeroPoints << "_";
+        result << "decompression=" << enableDecompression;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t outChannels;
+        ov::element::Type weightsPrecision;
+        bool transposeWeights, withZeroPoints, enableDecompression;
+        std::tie(inputShape, outChannels, weightsPrecision, transposeWeights, withZeroPoints, enableDecompression) = this->GetParam();
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_FC_WEIGHTS_DECOMPRESSION,
+                              enableDecompression ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO});
+
+        const auto ngPrc = ov::element::f32;
+        init_input_shapes({inputShape});
+
+        // the number of the activations rows is unknown for the dynamic shapes
+        const auto& dataShape = inputDynamicShapes.front();
+        size_t rows = 1;
+        for (size_t i = 0; i + 1 < dataShape.size(); i++)
+            rows = dataShape[i].is_static() ? rows * dataShape[i].get_length() : 0;
+        expectCompressed = enableDecompression && rows <= memoryBoundRows;
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        const size_t inChannels = inputDynamicShapes.front().rbegin()->get_length();
+        // MatMul computes data * weights^T if the weights are transposed
+        const ov::Shape weightsShape = transposeWeights ? ov::Shape{outChannels, inChannels} : ov::Shape{inChannels, outChannels};
+        const ov::Shape channelShape = transposeWeights ? ov::Shape{outChannels, 1} : ov::Shape{1, outChannels};
+
+        std::vector<float> weightsData(ov::shape_size(weightsShape));
+        for (size_t i = 0; i < weightsData.size(); i++) {
+            weightsData[i] = weightsPrecision == ov::element::u8 ? static_cast<float>(i % 251)
+                                                                 : static_cast<float>(i % 17) - 8.f;
+        }
+        auto weights = std::make_shared<ov::op::v0::Constant>(weightsPrecision, weightsShape, weightsData);
+        std::shared_ptr<ov::Node> decompression = std::make_shared<ov::op::v0::Convert>(weights, ngPrc);
+
+        if (withZeroPoints) {
+            std::vector<float> zeroPointsData(outChannels);
+            for (size_t i = 0; i < outChannels; i++)
+                zeroPointsData[i] = weightsPrecision == ov::element::u8 ? static_cast<float>(120 + i % 16) : static_cast<float>(i % 5) - 2.f;
+            auto zeroPoints = std::make_shared<ov::op::v0::Constant>(weightsPrecision, channelShape, zeroPointsData);
+            auto zeroPointsConvert = std::make_shared<ov::op::v0::Convert>(zeroPoints, ngPrc);
+            decompression = std::make_shared<ov::op::v1::Subtract>(decompression, zeroPointsConvert);
+        }
+
+        std::vector<float> scalesData(outChannels);
+        for (size_t i = 0; i < outChannels; i++)
+            scalesData[i] = 0.01f * static_cast<float>(i % 7 + 1);
+        auto scales = std::make_shared<ov::op::v0::Constant>(ngPrc, channelShape, scalesData);
+        decompression = std::make_shared<ov::op::v1::Multiply>(decompression, scales);
+
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], decompression, false, transposeWeights);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{matMul}, params, "FCWeightsDecompression");
+    }
+
+    void checkWeightsPrecision() {
+        auto runtimeModel = compiledModel.get_runtime_model();
+        for (const auto& node : runtimeModel->get_ops()) {
+            if (node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            ASSERT_EQ(expectCompressed, node->get_input_element_type(1) != ov::element::f32) << node->get_input_element_type(1);
+        }
+    }
+
+    static constexpr size_t memoryBoundRows = 32;
+    bool expectCompressed = false;
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    checkWeightsPrecision();
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 256}}},
+    {{}, {{2, 9, 128}}},
+    {{-1, 256}, {{1, 256}, {17, 256}, {1, 256}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(64, 77),
+                                            ::testing::Values(ov::element::u8, ov::element::i8, ov::element::f16),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+// the compute bound FullyConnected and the disabled decompression use oneDNN on the folded f32 weights
+const std::vector<InputShape> inputShapesOneDNN = {
+    {{}, {{1, 256}}},
+    {{}, {{64, 256}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_OneDNN, FCWeightsDecompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesOneDNN),
+                                            ::testing::Values(64),
+                                            ::testing::Values(ov::element::u8, ov::element::f16),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true, false)),
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+
+}  // namespace SubgraphTestsDefinitions
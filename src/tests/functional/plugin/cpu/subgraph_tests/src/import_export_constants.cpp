@@ -0,0 +1,80 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+#include <sstream>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The exported CPU blob stores the (reordered) weights computed by the constant subgraphs,
+   so the imported network restores them instead of the execution. Checks the imported network results.
+
+       PARAM
+         |
+       CONV (blocked weights)
+         |
+     GROUP CONV
+         |
+      RESHAPE
+         |
+      MATMUL (FullyConnected weights)
+         |
+       RESULT
+*/
+
+using ImportExportConstantsParams = size_t;  // number of streams
+
+class ImportExportConstantsTest : public testing::WithParamInterface<ImportExportConstantsParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ImportExportConstantsParams>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::num_streams(static_cast<int32_t>(GetParam())));
+
+        const auto ngPrc = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({{1, 16, 10, 10}}));
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 32, true);
+        auto groupConv = ngraph::builder::makeGroupConvolution(conv, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                               ov::op::PadType::EXPLICIT, 32, 32, true);
+        auto reshapeConst = ngraph::builder::makeConstant<int64_t>(ov::element::i64, {2}, {1, 32 * 10 * 10});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(groupConv, reshapeConst, false);
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {32 * 10 * 10, 64}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(reshape, weights);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{matMul}, params, "ImportExportConstants");
+    }
+
+    void compile_model() override {
+        SubgraphBaseTest::compile_model();
+
+        std::stringstream blob;
+        compiledModel.export_model(blob);
+        compiledModel = core->import_model(blob, targetDevice, configuration);
+    }
+};
+
+TEST_P(ImportExportConstantsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImportExportConstants, ImportExportConstantsTest,
+                         ::testing::Values(1, 2),
+                         ImportExportConstantsTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
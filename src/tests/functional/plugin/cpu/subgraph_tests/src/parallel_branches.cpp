@@ -0,0 +1,65 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block executed with the parallel graph execution,
+   so the independent branches run concurrently and share the reused memory
+
+               PARAM
+       /      |       \       \
+   CONV1x1  CONV1x1  CONV1x1  MAXPOOL
+      |       |        |        |
+      |    CONV3x3  CONV3x3   CONV1x1
+      |       |        |        |
+      |       |     CONV3x3     |
+       \      |       /        /
+              CONCAT
+                |
+              RESULT
+*/
+
+class ParallelBranchesTest : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[InferenceEngine::PluginConfigInternalParams::KEY_CPU_PARALLEL_GRAPH_EXECUTION] =
+            InferenceEngine::PluginConfigParams::YES;
+
+        const auto ngPrc = element::f32;
+        auto params = builder::makeParams(ngPrc, {{1, 16, 20, 20}});
+
+        auto conv = [&](const Output<Node>& in, size_t kernel, size_t channels) {
+            const ptrdiff_t pad = kernel / 2;
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, channels, true);
+        };
+
+        auto branch0 = conv(params[0], 1, 8);
+        auto branch1 = conv(conv(params[0], 1, 8), 3, 16);
+        auto branch2 = conv(conv(conv(params[0], 1, 4), 3, 8), 3, 8);
+        auto pool = builder::makePooling(params[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch3 = conv(pool, 1, 8);
+
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{branch0, branch1, branch2, branch3}, 1);
+        auto result = std::make_shared<opset1::Result>(concat);
+        function = std::make_shared<Function>(result, params, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,68 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The dynamic graph inferred with the repeated input shapes, so the shape inference results recorded for
+   the input shape signature are reused. The reshape target shapes are computed from the input shape,
+   so the recorded shapes are checked against the input values as well.
+
+           PARAM
+           |   \
+        MATMUL  SHAPEOF
+           |       |
+          ADD    GATHER
+           |       |
+        RESHAPE - CONCAT
+           |
+        SOFTMAX
+           |
+        RESHAPE - SHAPEOF(PARAM)
+           |
+         RESULT
+*/
+
+class RepeatedDynamicShapesTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ov::element::f32;
+        InputShape inputShape{{1, -1, 64}, {{1, 10, 64}, {1, 20, 64}, {1, 10, 64}, {1, 20, 64}, {1, 7, 64}, {1, 10, 64}}};
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {64, 64}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weights);
+        auto bias = ngraph::builder::makeConstant<float>(ngPrc, {64}, {}, true);
+        auto add = std::make_shared<ov::op::v1::Add>(matMul, bias);
+
+        auto shapeOf = std::make_shared<ov::op::v3::ShapeOf>(params[0]);
+        auto gather = std::make_shared<ov::op::v8::Gather>(shapeOf,
+                                                           ov::op::v0::Constant::create(ov::element::i64, {2}, {0, 1}),
+                                                           ov::op::v0::Constant::create(ov::element::i64, {}, {0}));
+        auto heads = ov::op::v0::Constant::create(ov::element::i64, {2}, {8, 8});
+        auto splitShape = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather, heads}, 0);
+        auto split = std::make_shared<ov::op::v1::Reshape>(add, splitShape, false);
+
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(split, 3);
+        auto merge = std::make_shared<ov::op::v1::Reshape>(softmax, shapeOf, false);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{merge}, params, "RepeatedDynamicShapes");
+    }
+};
+
+TEST_F(RepeatedDynamicShapesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,64 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The eltwise chain with dynamic shapes is tokenized by snippets. The input shapes change both the schedule only
+   (the same kernel is reused) and the broadcasting over the innermost dimension (another kernel is compiled).
+
+        PARAM0
+          |
+      TRANSPOSE   PARAM1
+            \     /
+              ADD
+               |
+            MULTIPLY (const)
+               |
+             SIGMOID
+               |
+            SUBTRACT (PARAM1)
+               |
+             RESULT
+*/
+
+class SnippetsDynamicShapesTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto ngPrc = ov::element::f32;
+        InputShape dataShape{{-1, 64, -1}, {{1, 64, 10}, {2, 64, 17}, {1, 64, 10}, {4, 64, 3}, {2, 64, 17}}};
+        InputShape addendShape{{-1, -1, -1}, {{1, 10, 64}, {2, 17, 1}, {1, 1, 64}, {4, 3, 64}, {1, 17, 1}}};
+        init_input_shapes({dataShape, addendShape});
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto order = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 1});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(params[0], order);
+        auto add = std::make_shared<ov::op::v1::Add>(transpose, params[1]);
+        auto scale = ngraph::builder::makeConstant<float>(ngPrc, {64}, {}, true);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(add, scale);
+        auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(mul);
+        auto sub = std::make_shared<ov::op::v1::Subtract>(sigmoid, params[1]);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{sub}, params, "SnippetsDynamicShapes");
+    }
+};
+
+TEST_F(SnippetsDynamicShapesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The normalization over the innermost axis is tokenized by snippets together with the following eltwise
+   operations, so the whole block is executed as a single Subgraph node.
+
+          PARAM
+            |
+         MATMUL
+            |
+     SOFTMAX / MVN
+            |
+        MULTIPLY (gamma)
+            |
+          ADD (beta)
+            |
+         RESULT
+*/
+
+enum class NormalizationType {
+    SOFTMAX,
+    MVN
+};
+
+using SnippetsNormalizationParams = std::tuple<NormalizationType, ov::Shape>;
+
+class SnippetsNormalizationTest : public testing::WithParamInterface<SnippetsNormalizationParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsNormalizationParams>& obj) {
+        NormalizationType type;
+        ov::Shape shape;
+        std::tie(type, shape) = obj.param;
+
+        std::ostringstream result;
+        result << (type == NormalizationType::SOFTMAX ? "Softmax" : "MVN") << "_";
+        result << "IS=" << CommonTestUtils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        NormalizationType type;
+        ov::Shape shape;
+        std::tie(type, shape) = this->GetParam();
+
+        const auto ngPrc = ov::element::f32;
+        init_input_shapes(static_shapes_to_test_representation({shape}));
+        auto params = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        const size_t channels = shape.back();
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {channels, channels}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], weights);
+
+        std::shared_ptr<ov::Node> normalization;
+        if (type == NormalizationType::SOFTMAX) {
+            normalization = std::make_shared<ov::op::v1::Softmax>(matMul, shape.size() - 1);
+        } else {
+            auto axes = ov::op::v0::Constant::create(ov::element::i64, {1}, {-1});
+            normalization = std::make_shared<ov::op::v6::MVN>(matMul, axes, true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+        }
+
+        auto gamma = ngraph::builder::makeConstant<float>(ngPrc, {channels}, {}, true);
+        auto beta = ngraph::builder::makeConstant<float>(ngPrc, {channels}, {}, true);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(normalization, gamma);
+        auto add = std::make_shared<ov::op::v1::Add>(mul, beta);
+
+        function = std::make_shared<ov::Model>(ov::NodeVector{add}, params, "SnippetsNormalization");
+    }
+};
+
+TEST_P(SnippetsNormalizationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+    CheckNumberOfNodesWithType(compiledModel, "MVN", 0);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {16, 64},
+    {16, 77},
+    {128, 768},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsNormalization, SnippetsNormalizationTest,
+                         ::testing::Combine(::testing::Values(NormalizationType::SOFTMAX, NormalizationType::MVN),
+                                            ::testing::ValuesIn(inputShapes)),
+                         SnippetsNormalizationTest::getTestCaseName);
+
+} // namespace
+
+}  // namespace SubgraphTestsDefinitions
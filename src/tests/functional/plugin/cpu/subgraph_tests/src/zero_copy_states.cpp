@@ -0,0 +1,100 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The consumer of ReadValue and the producer of Assign bind the data pointers in prepareParams, so the state buffers
+   swapped after each inference are not bound to their edges and the data is copied. The state is accumulated over
+   several inferences and checked against the reference: state' = T(T(state) + x) = state + T(x).
+
+     READ_VALUE
+         |
+     TRANSPOSE    PARAM
+           |      |
+             ADD
+            |   |
+    TRANSPOSE   RESULT
+        |
+     ASSIGN
+*/
+
+using ZeroCopyStatesParams = std::string;  // CPU_ZERO_COPY_STATES value
+
+class ZeroCopyStatesTest : public testing::WithParamInterface<ZeroCopyStatesParams>,
+                           virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ZeroCopyStatesParams>& obj) {
+        return "zeroCopyStates=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_ZERO_COPY_STATES, GetParam()});
+
+        const auto ngPrc = ov::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {{side, side}});
+
+        auto init = ngraph::builder::makeConstant<float>(ngPrc, {side, side}, {0.0f});
+        auto readValue = std::make_shared<ov::op::v3::ReadValue>(init, "state");
+        auto order = ngraph::builder::makeConstant<int64_t>(ov::element::i64, {2}, {1, 0});
+        auto stateTranspose = std::make_shared<ov::op::v1::Transpose>(readValue, order);
+        auto add = std::make_shared<ov::op::v1::Add>(stateTranspose, params[0]);
+        auto outputTranspose = std::make_shared<ov::op::v1::Transpose>(add, order);
+        auto assign = std::make_shared<ov::op::v3::Assign>(outputTranspose, "state");
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                               ov::SinkVector{assign},
+                                               params,
+                                               "ZeroCopyStates");
+    }
+
+    static constexpr size_t side = 16;
+};
+
+TEST_P(ZeroCopyStatesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+
+    ov::Tensor input(ov::element::f32, {side, side});
+    auto inputData = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        inputData[i] = static_cast<float>(i % 7) - 3.0f;
+    inferRequest.set_input_tensor(input);
+
+    std::vector<float> state(side * side, 0.0f);
+    for (size_t iteration = 0; iteration < 5; iteration++) {
+        inferRequest.infer();
+
+        const auto output = inferRequest.get_output_tensor();
+        const auto outputData = output.data<const float>();
+        for (size_t i = 0; i < side; i++) {
+            for (size_t j = 0; j < side; j++) {
+                // output = T(state) + x
+                ASSERT_EQ(outputData[i * side + j], state[j * side + i] + inputData[i * side + j])
+                    << "iteration " << iteration << " at (" << i << ", " << j << ")";
+            }
+        }
+        // state' = T(output)
+        for (size_t i = 0; i < side; i++)
+            for (size_t j = 0; j < side; j++)
+                state[j * side + i] = outputData[i * side + j];
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ZeroCopyStates, ZeroCopyStatesTest,
+                         ::testing::Values(InferenceEngine::PluginConfigParams::YES,
+                                           InferenceEngine::PluginConfigParams::NO),
+                         ZeroCopyStatesTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -10,6 +10,7 @@
 #include <gpu/gpu_config.hpp>
 #include <common_test_utils/test_common.hpp>
 #include <functional_test_utils/plugin_cache.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "functional_test_utils/blob_utils.hpp"
@@ -49,6 +50,8 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    size_t time_out = 1;  // minimal to reduce test time
+    size_t num_partial_batch_networks = 0;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
     void TestAutoBatch() {
@@ -74,8 +77,10 @@ protected:
                 config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
             if (device_name.find("CPU") != std::string::npos)
                 config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
-            // minimize timeout to reduce test time
-            config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(time_out);
+            if (num_partial_batch_networks)
+                config[CONFIG_KEY_INTERNAL(AUTO_BATCH_PARTIAL_BATCH_NETWORKS)] =
+                    std::to_string(num_partial_batch_networks);
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     device_name + "(" + std::to_string(num_batch) + ")",
                                                config);
@@ -158,6 +163,22 @@ public:
     }
 };
 
+// the requests not filling the batch are collected until the time-out and executed with the smaller batch networks
+class AutoBatching_Test_PartialBatch : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        std::tie(device_name, use_get_blob, num_streams, num_requests, num_batch) = this->GetParam();
+        fn_ptrs = {ngraph::builder::subgraph::makeSingleConv(),
+                   ngraph::builder::subgraph::makeMultiSingleConv()};
+        time_out = 100;
+        num_partial_batch_networks = 3;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "PartialBatch_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -166,4 +187,8 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatch, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -184,4 +185,37 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelineParallel) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_PARALLEL)] = CONFIG_VALUE(YES);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    ASSERT_TRUE(executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE_PARALLEL)).as<bool>());
+
+    // the requests in flight outnumber the device requests of the stages, so some of them wait in the queues
+    const auto expectedOutputs = GetOutputs();
+    const auto requestsNum =
+        executableNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() + 2;
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < requestsNum; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            requests.back().SetBlob(input.first, inferRequest.GetBlob(input.first));
+        }
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+        size_t i = 0;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(expectedOutputs[i++], request.GetBlob(output.first));
+        }
+    }
+}
+
 }  //  namespace HeteroTests
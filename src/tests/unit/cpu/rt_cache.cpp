@@ -379,3 +379,83 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(CacheEntryTests, SmokeConcurrentBuildOnce) {
+    using testing::_;
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 64;
+    constexpr size_t shards = 8;
+    constexpr size_t numThreads = 16;
+
+    mockBuilder<ValueType::element_type, IntKey> builderMock;
+    EXPECT_CALL(builderMock, build(_))
+            .Times(capacity)
+            .WillRepeatedly([](const IntKey& key){return key.data;});
+
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(builderMock.build(key)); };
+
+    CacheEntry<IntKey, ValueType> entry(capacity, shards);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto result = entry.getOrCreate({i}, builder);
+            ASSERT_NE(result.first, ValueType());
+            ASSERT_EQ(*result.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto statistics = entry.getStatistics();
+    ASSERT_EQ(statistics.misses, capacity);
+    ASSERT_EQ(statistics.hits, capacity * (numThreads - 1));
+    ASSERT_EQ(statistics.evictions, 0u);
+}
+
+TEST(CacheEntryTests, BuilderException) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+
+    CacheEntry<IntKey, ValueType> entry(capacity, 2);
+
+    auto throwingBuilder = [](const IntKey& key) -> ValueType { throw std::runtime_error("build failed"); };
+    auto builder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    ASSERT_THROW(entry.getOrCreate({1}, throwingBuilder), std::runtime_error);
+
+    //the failed build is not cached
+    auto result = entry.getOrCreate({1}, builder);
+    ASSERT_NE(result.first, ValueType());
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+
+    auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.misses, 3 * capacity);
+    ASSERT_EQ(statistics.hits, capacity);
+    ASSERT_EQ(statistics.evictions, capacity);
+}
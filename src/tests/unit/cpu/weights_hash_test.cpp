@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<unsigned char> makeRandomData(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<unsigned char> data(size);
+    for (auto& v : data)
+        v = static_cast<unsigned char>(dist(gen));
+    return data;
+}
+} // namespace
+
+TEST(WeightsHashTests, SmallBufferMatchesXXHash64) {
+    SimpleDataHash hasher;
+    const char* text = "Nobody inspects the spammish repetition";
+    ASSERT_EQ(0xEF46DB3751D8E999ull, hasher.hash(reinterpret_cast<const unsigned char*>(""), 0));
+    ASSERT_EQ(0x44BC2CF5AD770999ull, hasher.hash(reinterpret_cast<const unsigned char*>("abc"), 3));
+    ASSERT_EQ(0xFBCEA83C8A378BF1ull, hasher.hash(reinterpret_cast<const unsigned char*>(text), std::strlen(text)));
+}
+
+TEST(WeightsHashTests, ChunkedBufferIsDeterministic) {
+    SimpleDataHash hasher;
+    const size_t size = 3 * SimpleDataHash::kChunkSize + 123;
+    auto data = makeRandomData(size);
+
+    const auto first = hasher.hash(data.data(), data.size());
+    for (int i = 0; i < 5; i++)
+        ASSERT_EQ(first, hasher.hash(data.data(), data.size()));
+}
+
+TEST(WeightsHashTests, ChunkedBufferDependsOnEachByte) {
+    SimpleDataHash hasher;
+    const size_t size = 3 * SimpleDataHash::kChunkSize + 123;
+    auto data = makeRandomData(size);
+    const auto original = hasher.hash(data.data(), data.size());
+
+    for (size_t pos : {size_t(0), SimpleDataHash::kChunkSize - 1, SimpleDataHash::kChunkSize, size - 1}) {
+        data[pos] ^= 1;
+        ASSERT_NE(original, hasher.hash(data.data(), data.size())) << "position " << pos;
+        data[pos] ^= 1;
+    }
+    // the same content of the swapped chunks gives different hash
+    std::swap_ranges(data.begin(), data.begin() + SimpleDataHash::kChunkSize, data.begin() + SimpleDataHash::kChunkSize);
+    ASSERT_NE(original, hasher.hash(data.data(), data.size()));
+    // the size is a part of the hash
+    ASSERT_NE(hasher.hash(data.data(), data.size()), hasher.hash(data.data(), data.size() - 1));
+}
@@ -403,6 +403,45 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static std::shared_ptr<ngraph::Function> create_function_with_weights(size_t weightsSize, float value = 1.f) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, weightsSize});
+    std::vector<float> weights(weightsSize, 1.f);
+    weights.back() = value;
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, weightsSize}, weights);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(data, constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(mul);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    // big enough for the memoized hash of the constant
+    constexpr size_t weightsSize = 64 * 1024;
+    auto net1 = CNNNetwork(create_function_with_weights(weightsSize));
+    auto net2 = CNNNetwork(create_function_with_weights(weightsSize));
+    auto net3 = CNNNetwork(create_function_with_weights(weightsSize, 2.f));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+    // memoized
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentTopology) {
+    auto fun1 = create_simple_function();
+    auto fun2 = create_simple_function();
+    // swap inputs of the multiply
+    auto mul = fun2->get_results()[0]->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0);
+    auto param = mul->input_value(0);
+    mul->input(0).replace_source_output(mul->input_value(1));
+    mul->input(1).replace_source_output(param);
+    ASSERT_NE(NetworkCompilationContext::computeHash(CNNNetwork(fun1), {}),
+              NetworkCompilationContext::computeHash(CNNNetwork(fun2), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <threading/ie_thread_safe_containers.hpp>
+
+using namespace InferenceEngine;
+using namespace std::chrono;
+
+TEST(LockFreeBoundedQueueTests, PushPopUntilFull) {
+    LockFreeBoundedQueue<int> queue(5);
+    ASSERT_EQ(8u, queue.capacity());
+
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 8; ++i) {
+            int value = i;
+            ASSERT_TRUE(queue.try_push(std::move(value)));
+        }
+        int value = 8;
+        ASSERT_FALSE(queue.try_push(std::move(value)));
+        ASSERT_EQ(8, value);
+
+        for (int i = 0; i < 8; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(i, value);
+        }
+        ASSERT_FALSE(queue.try_pop(value));
+    }
+}
+
+TEST(ThreadSafeQueueWithSizeTests, OverflowKeepsFifoOrder) {
+    ThreadSafeQueueWithSize<int> queue;
+    constexpr int count = 5000;  // more than the lock-free ring capacity
+    for (int i = 0; i < count; ++i)
+        queue.push(i);
+    ASSERT_EQ(static_cast<size_t>(count), queue.size());
+
+    int value = -1;
+    for (int i = 0; i < count; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(ThreadSafeQueueWithSizeTests, InterleavedPushPopKeepsFifoOrderThroughOverflow) {
+    ThreadSafeQueueWithSize<int> queue;
+    constexpr int count = 5000;
+    int pushed = 0;
+    int expected = 0;
+    int value = -1;
+    // the ring gets full, then the values are popped while the overflow queue is drained and refilled,
+    // until the overflow is empty and the ring is used again
+    for (; pushed < 3000; ++pushed)
+        queue.push(pushed);
+    while (pushed < count) {
+        for (int i = 0; i < 3 && pushed < count; ++i)
+            queue.push(pushed++);
+        for (int i = 0; i < 5 && expected < pushed; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(expected++, value);
+        }
+    }
+    while (queue.try_pop(value))
+        ASSERT_EQ(expected++, value);
+    ASSERT_EQ(count, expected);
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(ThreadSafeQueueWithSizeTests, MultipleProducersKeepOrderOfEachProducer) {
+    ThreadSafeQueueWithSize<int64_t> queue;
+    constexpr int producers = 4;
+    constexpr int64_t count = 100000;  // the ring overflows as the single consumer is slower than the producers
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int64_t i = 0; i < count; ++i)
+                queue.push(p * count + i);
+        });
+    }
+    std::vector<int64_t> next(producers, 0);
+    bool ordered = true;
+    for (int64_t popped = 0; popped < producers * count;) {
+        int64_t value;
+        if (queue.try_pop(value)) {
+            const auto producer = value / count;
+            ordered = ordered && next[producer]++ == value % count;
+            ++popped;
+        }
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_TRUE(ordered);
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(ThreadSafeQueueWithSizeTests, MultipleProducersMultipleConsumers) {
+    ThreadSafeQueueWithSize<int64_t> queue;
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int64_t count = 100000;
+
+    std::atomic<int64_t> sum{0};
+    std::atomic<int64_t> popped{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (int64_t i = 1; i <= count; ++i)
+                queue.push(i);
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            int64_t value;
+            while (popped.load() < producers * count) {
+                if (queue.try_pop(value)) {
+                    sum += value;
+                    ++popped;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(producers * count * (count + 1) / 2, sum.load());
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(ThreadSafeParkingQueueTests, StopReturnsRemainingValues) {
+    ThreadSafeParkingQueue<int> queue;
+    queue.push(1);
+    queue.push(2);
+    queue.stop();
+
+    int value = 0;
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(1, value);
+    ASSERT_TRUE(queue.pop(value));
+    ASSERT_EQ(2, value);
+    ASSERT_FALSE(queue.pop(value));
+}
+
+TEST(ThreadSafeParkingQueueTests, WakesUpParkedConsumer) {
+    ThreadSafeParkingQueue<int> queue;
+    auto consumer = std::async(std::launch::async, [&] {
+        int value = 0;
+        return queue.pop(value) ? value : -1;
+    });
+    // let the consumer park
+    std::this_thread::sleep_for(milliseconds(100));
+    queue.push(42);
+    ASSERT_EQ(42, consumer.get());
+}